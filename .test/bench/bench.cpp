@@ -0,0 +1,408 @@
+/*
+###############################################################################
+#
+#   Test: performance benchmarks
+#
+#   AUTHOR: Maciej_Bak
+#   AFFILIATION: Swiss_Institute_of_Bioinformatics
+#   CONTACT: wsciekly.maciek@gmail.com
+#   CREATED: 17-10-2026
+#   LICENSE: MIT
+#
+###############################################################################
+*/
+
+// Every operator, exp(), log(), sqrt() and pow() of two numbers is timed
+// for float, double, long double, double_double, quad_double, __float128
+// (where libquadmath is available) and mpfr_t (at several precisions,
+// among them the 106, 113 and 212 bits of the extended precision types)
+// in all dimensions from 1 to 256.
+// Two numbers are reported for each combination:
+// * throughput: operations per second over a batch of independent operands
+// * latency: nanoseconds per operation when each call has to wait for
+//   the result of the previous one (the real part of a result is fed,
+//   multiplied by zero, into the next left operand)
+// Compound assignments include a copy of the left operand.
+// Results are written as JSON, one record per combination.
+//
+// Usage: bench [--output FILE] [--min-time SECONDS] [--max-dim DIM]
+
+#include "hypercomplex/Hypercomplex.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct Record {
+    std::string type;
+    unsigned int precision;
+    unsigned int dim;
+    std::string operation;
+    std::size_t batch;
+    double throughput;
+    double latency;
+};
+
+struct Settings {
+    std::string output = "bench.json";
+    double min_time = 0.05;
+    unsigned int max_dim = 256;
+};
+
+const unsigned int mpfr_precisions[] = {64, 106, 113, 128, 212, 256, 1024};
+
+// keep the compiler from discarding computations on the pointed memory
+template <typename P>
+inline void escape(P* p) {
+    asm volatile("" : : "g"(p) : "memory");
+}
+
+// average duration of a single call, repeated for at least min_time
+template <typename F>
+double seconds_per_call(const F &f, const double min_time) {
+    f();  // warm-up
+    std::size_t calls = 1;
+    for (;;) {
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t k=0; k < calls; k++) f();
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= min_time) return elapsed.count() / calls;
+        double scale = 10.0;
+        if (elapsed.count() > 0.0)
+            scale = std::min(10.0, 1.5 * min_time / elapsed.count());
+        calls = static_cast<std::size_t>(calls * std::max(2.0, scale));
+    }
+}
+
+// unit-norm operands, so that products and powers stay bounded
+std::vector<double> unit_components(
+    const unsigned int dim,
+    const std::size_t count,
+    const unsigned int seed
+) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<double> values(dim * count);
+    for (std::size_t j=0; j < count; j++) {
+        double norm = 0.0;
+        for (unsigned int i=0; i < dim; i++) {
+            values[j * dim + i] = distribution(generator);
+            norm += values[j * dim + i] * values[j * dim + i];
+        }
+        norm = std::sqrt(norm);
+        for (unsigned int i=0; i < dim; i++) values[j * dim + i] /= norm;
+    }
+    return values;
+}
+
+template <typename T>
+struct Traits {
+    static std::string name() {
+        if (std::is_same<T, float>::value) return "float";
+        if (std::is_same<T, double>::value) return "double";
+        if (std::is_same<T, double_double>::value) return "double_double";
+        if (std::is_same<T, quad_double>::value) return "quad_double";
+#ifdef HYPERCOMPLEX_QUADMATH
+        if (std::is_same<T, __float128>::value) return "__float128";
+#endif
+        return "long double";
+    }
+
+    static unsigned int precision() {
+#ifdef HYPERCOMPLEX_QUADMATH
+        if constexpr (std::is_same<T, __float128>::value)
+            return FLT128_MANT_DIG;
+        else
+#endif
+        if constexpr (std::is_floating_point<T>::value)
+            return std::numeric_limits<T>::digits;
+        else
+            return T::digits;
+    }
+
+    template <unsigned int dim>
+    static std::vector<Hypercomplex<T, dim>> numbers(
+        const std::size_t count,
+        const unsigned int seed
+    ) {
+        std::vector<double> values = unit_components(dim, count, seed);
+        std::vector<Hypercomplex<T, dim>> H;
+        T A[dim];  // NOLINT
+        for (std::size_t j=0; j < count; j++) {
+            for (unsigned int i=0; i < dim; i++)
+                A[i] = static_cast<T>(values[j * dim + i]);
+            H.emplace_back(A);
+        }
+        return H;
+    }
+
+    template <unsigned int dim>
+    static void norm(Hypercomplex<T, dim> &out, const Hypercomplex<T, dim> &H) {
+        out[0] = H.norm();
+    }
+
+    // value-preserving data dependency of H on the result R
+    template <unsigned int dim>
+    static void chain(Hypercomplex<T, dim> &H, const Hypercomplex<T, dim> &R) {
+        H[0] = H[0] + R[0] * static_cast<T>(0);
+    }
+};
+
+// MPFR operations are sequential library calls that do not overlap,
+// so no artificial dependency is needed between them.
+template <>
+struct Traits<mpfr_t> {
+    static std::string name() { return "mpfr_t"; }
+
+    static unsigned int precision() { return get_mpfr_precision(); }
+
+    template <unsigned int dim>
+    static std::vector<Hypercomplex<mpfr_t, dim>> numbers(
+        const std::size_t count,
+        const unsigned int seed
+    ) {
+        std::vector<double> values = unit_components(dim, count, seed);
+        std::vector<Hypercomplex<mpfr_t, dim>> H;
+        mpfr_t A[dim];  // NOLINT
+        for (unsigned int i=0; i < dim; i++)
+            mpfr_init2(A[i], get_mpfr_precision());
+        for (std::size_t j=0; j < count; j++) {
+            for (unsigned int i=0; i < dim; i++)
+                mpfr_set_d(A[i], values[j * dim + i], MPFR_RNDN);
+            H.emplace_back(A);
+        }
+        for (unsigned int i=0; i < dim; i++) mpfr_clear(A[i]);
+        return H;
+    }
+
+    template <unsigned int dim>
+    static void norm(
+        Hypercomplex<mpfr_t, dim> &out,
+        const Hypercomplex<mpfr_t, dim> &H
+    ) {
+        H.norm(out[0]);
+    }
+
+    template <unsigned int dim>
+    static void chain(
+        Hypercomplex<mpfr_t, dim> &,
+        const Hypercomplex<mpfr_t, dim> &
+    ) {}
+};
+
+template <typename T, unsigned int dim, typename Op>
+void measure(
+    const char* operation,
+    const Op &op,
+    const Settings &settings,
+    std::vector<Record> &records
+) {
+    // fewer operands for expensive high-dimensional numbers
+    const std::size_t batch = dim <= 4 ? 16 : std::max(1u, 64 / dim);
+    std::vector<Hypercomplex<T, dim>> x = Traits<T>::template
+        numbers<dim>(batch, 1);
+    const std::vector<Hypercomplex<T, dim>> y = Traits<T>::template
+        numbers<dim>(batch, 2);
+    std::vector<Hypercomplex<T, dim>> out = x;
+
+    const double independent = seconds_per_call([&]() {
+        for (std::size_t j=0; j < batch; j++) op(out[j], x[j], y[j]);
+        escape(out.data());
+    }, settings.min_time);
+
+    const double dependent = seconds_per_call([&]() {
+        for (std::size_t j=0; j < batch; j++) {
+            op(out[j], x[j], y[j]);
+            Traits<T>::chain(x[(j + 1) % batch], out[j]);
+        }
+        escape(x.data());
+        escape(out.data());
+    }, settings.min_time);
+
+    Record record = {
+        Traits<T>::name(), Traits<T>::precision(), dim, operation, batch,
+        batch / independent, 1e9 * dependent / batch
+    };
+    std::cerr << record.type << " (" << record.precision << " bits) dim "
+              << dim << " " << operation << ": " << record.latency
+              << " ns" << std::endl;
+    records.push_back(record);
+}
+
+template <typename T, unsigned int dim>
+void measure_all(const Settings &settings, std::vector<Record> &records) {
+    typedef Hypercomplex<T, dim> H;
+    if (dim > settings.max_dim) return;
+
+    measure<T, dim>("~", [](H &out, const H &x, const H &) {
+        out = ~x;
+    }, settings, records);
+    measure<T, dim>("unary -", [](H &out, const H &x, const H &) {
+        out = -x;
+    }, settings, records);
+    measure<T, dim>("+", [](H &out, const H &x, const H &y) {
+        out = x + y;
+    }, settings, records);
+    measure<T, dim>("-", [](H &out, const H &x, const H &y) {
+        out = x - y;
+    }, settings, records);
+    measure<T, dim>("*", [](H &out, const H &x, const H &y) {
+        out = x * y;
+    }, settings, records);
+    if constexpr (std::is_same<T, mpfr_t>::value) {
+        set_mpfr_rounded_multiplication(true);
+        measure<T, dim>("rounded *", [](H &out, const H &x, const H &y) {
+            out = x * y;
+        }, settings, records);
+        set_mpfr_rounded_multiplication(false);
+    }
+    measure<T, dim>("/", [](H &out, const H &x, const H &y) {
+        out = x / y;
+    }, settings, records);
+    measure<T, dim>("^", [](H &out, const H &x, const H &) {
+        out = x ^ 7;
+    }, settings, records);
+    measure<T, dim>("+=", [](H &out, const H &x, const H &y) {
+        out = x;
+        out += y;
+    }, settings, records);
+    measure<T, dim>("-=", [](H &out, const H &x, const H &y) {
+        out = x;
+        out -= y;
+    }, settings, records);
+    measure<T, dim>("*=", [](H &out, const H &x, const H &y) {
+        out = x;
+        out *= y;
+    }, settings, records);
+    measure<T, dim>("/=", [](H &out, const H &x, const H &y) {
+        out = x;
+        out /= y;
+    }, settings, records);
+    measure<T, dim>("^=", [](H &out, const H &x, const H &) {
+        out = x;
+        out ^= 7;
+    }, settings, records);
+    measure<T, dim>("==", [](H &out, const H &x, const H &y) {
+        if (x == y) out = y;
+    }, settings, records);
+    measure<T, dim>("norm", [](H &out, const H &x, const H &) {
+        Traits<T>::norm(out, x);
+    }, settings, records);
+    measure<T, dim>("inv", [](H &out, const H &x, const H &) {
+        out = x.inv();
+    }, settings, records);
+    measure<T, dim>("exp", [](H &out, const H &x, const H &) {
+        out = exp(x);
+    }, settings, records);
+    measure<T, dim>("log", [](H &out, const H &x, const H &) {
+        out = log(x);
+    }, settings, records);
+    measure<T, dim>("sqrt", [](H &out, const H &x, const H &) {
+        out = sqrt(x);
+    }, settings, records);
+    measure<T, dim>("pow", [](H &out, const H &x, const H &y) {
+        out = pow(x, y);
+    }, settings, records);
+
+    if constexpr (dim < 256) measure_all<T, 2 * dim>(settings, records);
+}
+
+std::string timestamp() {
+    char buffer[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ",
+                  std::gmtime(&now));
+    return buffer;
+}
+
+std::string simd() {
+#if defined(HYPERCOMPLEX_NO_SIMD)
+    return "none";
+#elif defined(__AVX512F__)
+    return "avx512f";
+#elif defined(__AVX2__)
+    return "avx2";
+#elif defined(__SSE2__)
+    return "sse2";
+#else
+    return "none";
+#endif
+}
+
+void write_json(std::ostream &os, const std::vector<Record> &records) {
+    os.precision(std::numeric_limits<double>::max_digits10);
+    os << "{\n";
+    os << "  \"library\": \"hypercomplex\",\n";
+    os << "  \"timestamp\": \"" << timestamp() << "\",\n";
+    os << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+    os << "  \"simd\": \"" << simd() << "\",\n";
+    os << "  \"mpfr\": \"" << mpfr_get_version() << "\",\n";
+    os << "  \"results\": [";
+    for (std::size_t k=0; k < records.size(); k++) {
+        const Record &r = records[k];
+        os << (k ? ",\n" : "\n");
+        os << "    {\"type\": \"" << r.type << "\", "
+           << "\"precision\": " << r.precision << ", "
+           << "\"dim\": " << r.dim << ", "
+           << "\"operation\": \"" << r.operation << "\", "
+           << "\"batch\": " << r.batch << ", "
+           << "\"throughput_ops_per_s\": " << r.throughput << ", "
+           << "\"latency_ns\": " << r.latency << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+int main(int argc, char* argv[]) {
+    Settings settings;
+    for (int k=1; k + 1 < argc; k += 2) {
+        if (!std::strcmp(argv[k], "--output")) {
+            settings.output = argv[k + 1];
+        } else if (!std::strcmp(argv[k], "--min-time")) {
+            settings.min_time = std::atof(argv[k + 1]);
+        } else if (!std::strcmp(argv[k], "--max-dim")) {
+            settings.max_dim = std::atoi(argv[k + 1]);
+        } else {
+            std::cerr << "unknown option: " << argv[k] << std::endl;
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "missing value for: " << argv[argc - 1] << std::endl;
+        return 1;
+    }
+
+    std::vector<Record> records;
+    measure_all<float, 1>(settings, records);
+    measure_all<double, 1>(settings, records);
+    measure_all<long double, 1>(settings, records);
+    measure_all<double_double, 1>(settings, records);
+    measure_all<quad_double, 1>(settings, records);
+#ifdef HYPERCOMPLEX_QUADMATH
+    measure_all<__float128, 1>(settings, records);
+#endif
+    for (const unsigned int precision : mpfr_precisions) {
+        set_mpfr_precision(precision);
+        measure_all<mpfr_t, 1>(settings, records);
+    }
+    clear_mpfr_memory();
+
+    std::ofstream file(settings.output);
+    write_json(file, records);
+    if (!file) {
+        std::cerr << "cannot write: " << settings.output << std::endl;
+        return 1;
+    }
+    std::cout << records.size() << " results written to "
+              << settings.output << std::endl;
+    return 0;
+}
@@ -12,6 +12,7 @@
 ###############################################################################
 */
 
+#include <iomanip>
 #include <iostream>
 #include "Hypercomplex.hpp"
 
@@ -47,6 +48,22 @@ int main(void){
 
     std::cout << "e^H1 = " << exp(H1) << std::endl;
 
+    std::cout << "log(H2) = " << log(H2) << std::endl;
+    std::cout << "sqrt(H2) = " << sqrt(H2) << std::endl;
+    std::cout << "H1^0.5 = " << pow(H1, 0.5) << std::endl;
+
+    HypercomplexArray<double, 4> HA(1000);
+    for (unsigned int j=0; j < HA.size(); j++) HA.set(j, H1);
+    HypercomplexArray<double, 4> HB = HA * ~HA;
+    std::cout << "(H1 * ~H1)[999] = " << HB.get(999) << std::endl;
+    HypercomplexArray<double, 4> HL = batch_log(HA);
+    std::cout << "log(H1) = " << HL.get(0) << std::endl;
+
+    double_double D[] = {1.0, 2.0, 0.0, -1.0};
+    Hypercomplex<double_double, 4> HD(D);
+    std::cout << std::setprecision(32) << "|HD| = " << HD.norm()
+              << std::setprecision(6) << std::endl;
+
     set_mpfr_precision(200);
 
     mpfr_t A[8];
@@ -73,6 +90,9 @@ int main(void){
     mpfr_out_str(stdout, 10, 0, (Hx^30)[0], MPFR_RNDN);
     std::cout << std::endl;
 
+    MPFRSerializer serializer(6, MPFRSerializer::Format::scientific);
+    serializer.write(std::cout << "Hx^30 = ", Hx^30) << std::endl;
+
     mpfr_clear(A[0]);
     mpfr_clear(A[1]);
     mpfr_clear(A[2]);
@@ -13,11 +13,26 @@
 */
 
 #define CATCH_CONFIG_RUNNER
+// MPFR products at 2048 bits or more use the reduced algorithm
+#define HYPERCOMPLEX_MPFR_REDUCED_PRECISION 2048
 #include "catch.hpp"
 #include "hypercomplex/Hypercomplex.hpp"
 #include <tuple>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
 
 template<typename T>
 using Hypercomplex0 = Hypercomplex<T, 0>;
@@ -33,7 +48,557 @@ using MPFR_Hypercomplex1 = Hypercomplex<mpfr_t, 1>;
 using MPFR_Hypercomplex2 = Hypercomplex<mpfr_t, 2>;
 using MPFR_Hypercomplex3 = Hypercomplex<mpfr_t, 3>;
 
-using TestTypes = std::tuple<float, double, long double>;
+#ifdef HYPERCOMPLEX_QUADMATH
+using TestTypes = std::tuple<
+    float, double, long double, double_double, quad_double, __float128
+>;
+#else
+using TestTypes = std::tuple<
+    float, double, long double, double_double, quad_double
+>;
+#endif
+using BuiltinTypes = std::tuple<float, double, long double>;
+using VectorisedTypes = std::tuple<float, double>;
+
+// reference: recursive Cayley-Dickson product (a,b)(c,d) = (ac-d*b,da+bc*)
+template<typename T>
+std::vector<T> cayley_dickson_product(
+    const std::vector<T> &x,
+    const std::vector<T> &y
+) {
+    const unsigned int n = x.size();
+    if (n == 1) return std::vector<T>{x[0] * y[0]};
+    const unsigned int h = n / 2;
+    auto conj = [](std::vector<T> v) {
+        for (unsigned int i=1; i < v.size(); i++) v[i] = -v[i];
+        return v;
+    };
+    std::vector<T> a(x.begin(), x.begin() + h), b(x.begin() + h, x.end());
+    std::vector<T> c(y.begin(), y.begin() + h), d(y.begin() + h, y.end());
+    std::vector<T> ac = cayley_dickson_product(a, c);
+    std::vector<T> d_b = cayley_dickson_product(conj(d), b);
+    std::vector<T> da = cayley_dickson_product(d, a);
+    std::vector<T> bc_ = cayley_dickson_product(b, conj(c));
+    std::vector<T> result(n);
+    for (unsigned int i=0; i < h; i++) result[i] = ac[i] - d_b[i];
+    for (unsigned int i=0; i < h; i++) result[i+h] = da[i] + bc_[i];
+    return result;
+}
+
+// pseudo-random operands for the multiplication tests
+template<typename T, const unsigned int dim>
+void random_operands(unsigned int seed, std::vector<T> &x, std::vector<T> &y) {
+    x.resize(dim);
+    y.resize(dim);
+    for (unsigned int i=0; i < dim; i++) {
+        seed = seed * 1103515245u + 12345u;
+        x[i] = static_cast<T>(static_cast<int>(seed >> 16) % 2001 - 1000) / 7;
+        seed = seed * 1103515245u + 12345u;
+        y[i] = static_cast<T>(static_cast<int>(seed >> 16) % 2001 - 1000) / 3;
+        if (i % 5 == 3) y[i] = -T();  // signed zeros
+    }
+}
+
+// compare the scalar kernel against the reference bit for bit
+// (requires -ffp-contract=off on targets with FMA instructions)
+template<typename T, const unsigned int dim>
+bool multiplication_matches_reference(unsigned int seed) {
+    std::vector<T> x, y;
+    random_operands<T, dim>(seed, x, y);
+    T H[dim];
+    cayley_dickson_multiply<T, dim>(x.data(), y.data(), H);
+    std::vector<T> reference = cayley_dickson_product(x, y);
+    using hypercomplex_math::signbit;
+    for (unsigned int i=0; i < dim; i++) {
+        if (H[i] != reference[i]) return false;
+        if (signbit(H[i]) != signbit(reference[i])) return false;
+    }
+    return true;
+}
+
+// at 53 bits the MPFR kernel must round exactly like the double one
+template<const unsigned int dim>
+bool mpfr_multiplication_matches_double(unsigned int seed) {
+    std::vector<double> x, y;
+    random_operands<double, dim>(seed, x, y);
+    double expected[dim];
+    cayley_dickson_multiply<double, dim>(x.data(), y.data(), expected);
+    mpfr_t X[dim], Y[dim], H[dim], workspace[dim];
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_init2(X[i], 53);
+        mpfr_init2(Y[i], 53);
+        mpfr_init2(H[i], 53);
+        mpfr_init2(workspace[i], 53);
+        mpfr_set_d(X[i], x[i], MPFR_RNDN);
+        mpfr_set_d(Y[i], y[i], MPFR_RNDN);
+    }
+    cayley_dickson_multiply<dim>(X, Y, H, workspace);
+    bool match = true;
+    for (unsigned int i=0; i < dim; i++) {
+        const double h = mpfr_get_d(H[i], MPFR_RNDN);
+        if (h != expected[i]) match = false;
+        if (std::signbit(h) != std::signbit(expected[i])) match = false;
+        mpfr_clear(X[i]);
+        mpfr_clear(Y[i]);
+        mpfr_clear(H[i]);
+        mpfr_clear(workspace[i]);
+    }
+    return match;
+}
+
+// adaptive operations must agree with a far more precise result
+// rounded to the target precision
+template<const unsigned int dim>
+bool adaptive_matches_reference(unsigned int seed, unsigned int precision) {
+    std::vector<double> x, y;
+    random_operands<double, dim>(seed, x, y);
+    mpfr_t X[dim], Y[dim];
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_init2(X[i], 500);
+        mpfr_init2(Y[i], 500);
+        mpfr_set_d(X[i], x[i] / 100, MPFR_RNDN);
+        mpfr_div_ui(X[i], X[i], 3, MPFR_RNDN);  // not representable
+        mpfr_set_d(Y[i], y[i] / 100 + 1, MPFR_RNDN);
+    }
+    bool match = true;
+    {
+        MPFRPrecisionScope scope(500);
+        Hypercomplex<mpfr_t, dim> H1(X);
+        Hypercomplex<mpfr_t, dim> H2(Y);
+        const Hypercomplex<mpfr_t, dim> results[] = {
+            adaptive_multiply(H1, H2, precision),
+            adaptive_divide(H1, H2, precision),
+            adaptive_inv(H2, precision),
+            adaptive_exp(H1, precision)
+        };
+        MPFRPrecisionScope reference(4 * precision + 200);
+        const Hypercomplex<mpfr_t, dim> exact[] = {
+            H1 * H2, H1 / H2, H2.inv(), exp(H1)
+        };
+        MPFRPrecisionScope target(precision);
+        for (unsigned int k=0; k < 4; k++) {
+            Hypercomplex<mpfr_t, dim> rounded(exact[k]);
+            if (!(results[k] == rounded)) match = false;
+            if (mpfr_get_prec(results[k][0]) != precision) match = false;
+        }
+    }
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_clear(X[i]);
+        mpfr_clear(Y[i]);
+    }
+    return match;
+}
+
+template<const unsigned int dim>
+bool rounded_multiplication_matches_reference(
+    unsigned int seed,
+    unsigned int precision
+) {
+    std::vector<double> x, y;
+    random_operands<double, dim>(seed, x, y);
+    mpfr_t X[dim], Y[dim];
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_init2(X[i], precision);
+        mpfr_init2(Y[i], precision);
+        mpfr_set_d(X[i], x[i], MPFR_RNDN);
+        mpfr_div_ui(X[i], X[i], 3, MPFR_RNDN);  // not representable
+        mpfr_set_d(Y[i], y[i], MPFR_RNDN);
+        mpfr_div_ui(Y[i], Y[i], 7, MPFR_RNDN);
+    }
+    bool match = true;
+    {
+        MPFRPrecisionScope scope(precision);
+        Hypercomplex<mpfr_t, dim> H1(X);
+        Hypercomplex<mpfr_t, dim> H2(Y);
+        set_mpfr_rounded_multiplication(true);
+        Hypercomplex<mpfr_t, dim> result = H1 * H2;
+        Hypercomplex<mpfr_t, dim> assigned(H1);
+        assigned *= H2;
+        set_mpfr_rounded_multiplication(false);
+        MPFRPrecisionScope reference(4 * precision + 200);
+        Hypercomplex<mpfr_t, dim> exact = H1 * H2;
+        MPFRPrecisionScope target(precision);
+        Hypercomplex<mpfr_t, dim> rounded(exact);
+        if (!(result == rounded) || !(assigned == rounded)) match = false;
+    }
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_clear(X[i]);
+        mpfr_clear(Y[i]);
+    }
+    return match;
+}
+
+// exact value of an extended precision number (at 1000 bits)
+void expansion_to_mpfr(mpfr_t out, const double_double &a) {
+    mpfr_set_d(out, a.hi, MPFR_RNDN);
+    mpfr_add_d(out, out, a.lo, MPFR_RNDN);
+}
+
+void expansion_to_mpfr(mpfr_t out, const quad_double &a) {
+    mpfr_set_d(out, a.x[0], MPFR_RNDN);
+    for (unsigned int i=1; i < 4; i++) mpfr_add_d(out, out, a.x[i], MPFR_RNDN);
+}
+
+#ifdef HYPERCOMPLEX_QUADMATH
+void expansion_to_mpfr(mpfr_t out, const __float128 a) {
+    // 113 bits fit in three doubles
+    __float128 r = a;
+    mpfr_set_ui(out, 0, MPFR_RNDN);
+    for (unsigned int i=0; i < 3; i++) {
+        const double d = static_cast<double>(r);
+        mpfr_add_d(out, out, d, MPFR_RNDN);
+        r -= d;
+    }
+}
+#endif
+
+// binary logarithm of the relative error of a against the exact value
+template<typename T>
+double expansion_error(const T &a, const mpfr_t exact) {
+    mpfr_t e;
+    mpfr_init2(e, 1000);
+    expansion_to_mpfr(e, a);
+    mpfr_sub(e, e, exact, MPFR_RNDN);
+    double bits = -1000.0;
+    if (!mpfr_zero_p(e)) {
+        mpfr_div(e, e, exact, MPFR_RNDN);
+        bits = std::log2(std::fabs(mpfr_get_d(e, MPFR_RNDN)));
+    }
+    mpfr_clear(e);
+    return bits;
+}
+
+// full-precision pseudo-random operand in (-scale, scale)
+template<typename T>
+T expansion_operand(unsigned int &seed, const double scale) {
+    T a = T();
+    for (int i=0; i < 6; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const double d = static_cast<int>(seed >> 8) / 16777216.0 - 0.5;
+        a += T(std::ldexp(d, -24 * i));
+    }
+    return a * (2 * scale);
+}
+
+// largest relative error of the arithmetic and elementary functions
+// over pseudo-random operands, including cancelling ones
+template<typename T>
+double expansion_max_error(unsigned int seed) {
+    using namespace hypercomplex_math;  // NOLINT
+    mpfr_t a, b, r;
+    mpfr_inits2(1000, a, b, r, static_cast<mpfr_ptr>(0));
+    double bits = -1000.0;
+    for (unsigned int k=0; k < 500; k++) {
+        const T x = expansion_operand<T>(seed, 10.0);
+        T y = expansion_operand<T>(seed, 10.0);
+        if (k % 3 == 0) y = x + expansion_operand<T>(seed, 1e-20);
+        expansion_to_mpfr(a, x);
+        expansion_to_mpfr(b, y);
+        mpfr_add(r, a, b, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(x + y, r));
+        mpfr_sub(r, a, b, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(x - y, r));
+        mpfr_mul(r, a, b, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(x * y, r));
+        mpfr_div(r, a, b, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(x / y, r));
+        mpfr_abs(r, a, MPFR_RNDN);
+        mpfr_sqrt(r, r, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(sqrt(abs(x)), r));
+        mpfr_exp(r, a, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(exp(x), r));
+        mpfr_sin(r, a, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(sin(x), r));
+        mpfr_cos(r, a, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(cos(x), r));
+        mpfr_atan2(r, a, b, MPFR_RNDN);
+        bits = std::max(bits, expansion_error(atan2(x, y), r));
+        mpfr_abs(r, a, MPFR_RNDN);
+        mpfr_log(r, r, MPFR_RNDN);
+        // the error of the logarithm is absolute close to 1
+        if (std::fabs(mpfr_get_d(r, MPFR_RNDN)) > 0.5)
+            bits = std::max(bits, expansion_error(log(abs(x)), r));
+    }
+    mpfr_clears(a, b, r, static_cast<mpfr_ptr>(0));
+    return bits;
+}
+
+// base type counting its multiplications, marked for the reduced kernel
+struct CountedDouble {
+    double v;
+    static inline unsigned int multiplications = 0;
+    CountedDouble() : v(0) {}
+    CountedDouble(double x) : v(x) {}  // NOLINT
+};
+
+CountedDouble operator+(CountedDouble a, CountedDouble b) { return a.v + b.v; }
+CountedDouble operator-(CountedDouble a, CountedDouble b) { return a.v - b.v; }
+CountedDouble operator-(CountedDouble a) { return -a.v; }
+CountedDouble operator*(CountedDouble a, CountedDouble b) {
+    CountedDouble::multiplications++;
+    return a.v * b.v;
+}
+
+template <>
+struct ReducedMultiplication<CountedDouble> : std::true_type {};
+
+// compare the reduced kernel against the exact product: every
+// component is within 2^(levels + 8) u max_i |x[i]| max_i |y[i]|
+template<typename T, const unsigned int dim>
+bool reduced_within_tolerance(unsigned int seed) {
+    std::vector<T> x, y;
+    random_operands<T, dim>(seed, x, y);
+    T H[dim];
+    cayley_dickson_reduced_multiply<T, dim>(x.data(), y.data(), H);
+    std::vector<long double> x_(x.begin(), x.end()), y_(y.begin(), y.end());
+    std::vector<long double> reference = cayley_dickson_product(x_, y_);
+    long double mx = 0, my = 0;
+    for (unsigned int i=0; i < dim; i++) {
+        mx = std::max(mx, std::fabs(x_[i]));
+        my = std::max(my, std::fabs(y_[i]));
+    }
+    const long double bound = std::ldexp(
+        static_cast<long double>(std::numeric_limits<T>::epsilon()),
+        cayley_dickson_levels(dim) + 8) * mx * my;
+    for (unsigned int k=0; k < dim; k++)
+        if (std::fabs(H[k] - reference[k]) > bound) return false;
+    return true;
+}
+
+// compare operator* (possibly vectorised) against the exact product:
+// every component is within gamma_dim * sum_i |x[i]| |y[i ^ k]|
+template<typename T, const unsigned int dim>
+bool multiplication_within_tolerance(unsigned int seed) {
+    std::vector<T> x, y;
+    random_operands<T, dim>(seed, x, y);
+    Hypercomplex<T, dim> H = Hypercomplex<T, dim>(x.data()) *
+        Hypercomplex<T, dim>(y.data());
+    std::vector<long double> x_(x.begin(), x.end()), y_(y.begin(), y.end());
+    std::vector<long double> reference = cayley_dickson_product(x_, y_);
+    const long double u = std::numeric_limits<T>::epsilon() / 2;
+    const long double gamma = dim * u / (1 - dim * u);
+    for (unsigned int k=0; k < dim; k++) {
+        long double magnitude = 0;
+        for (unsigned int i=0; i < dim; i++)
+            magnitude += std::fabs(x_[i] * y_[i ^ k]);
+        // the long double reference is rounded as well
+        long double bound = gamma * magnitude +
+            dim * std::numeric_limits<long double>::epsilon() * magnitude;
+        if (std::fabs(H[k] - reference[k]) > bound) return false;
+    }
+    return true;
+}
+
+// same value and sign of every component
+template<typename T, const unsigned int dim>
+bool identical(const Hypercomplex<T, dim> &H1, const Hypercomplex<T, dim> &H2) {
+    using hypercomplex_math::signbit;
+    for (unsigned int i=0; i < dim; i++) {
+        if (H1[i] != H2[i]) return false;
+        if (signbit(H1[i]) != signbit(H2[i])) return false;
+    }
+    return true;
+}
+
+// compare bulk operations of HypercomplexArray against single elements
+template<typename T, const unsigned int dim>
+bool array_matches_elements(const std::size_t size, unsigned int seed) {
+    HypercomplexArray<T, dim> A1(size), A2(size);
+    for (std::size_t j=0; j < size; j++) {
+        std::vector<T> x, y;
+        random_operands<T, dim>(seed + j, x, y);
+        if (j % 7 == 2)  // purely real numbers
+            for (unsigned int i=1; i < dim; i++) x[i] = -T();
+        A1.set(j, Hypercomplex<T, dim>(x.data()));
+        A2.set(j, Hypercomplex<T, dim>(y.data()));
+    }
+    HypercomplexArray<T, dim> sum = A1 + A2, difference = A1 - A2;
+    HypercomplexArray<T, dim> product = A1 * A2, conjugate = ~A1;
+    HypercomplexArray<T, dim> inverse = A1.inv();
+    HypercomplexArray<T, dim> scaled(A1.size());
+    for (std::size_t j=0; j < size; j++)
+        scaled.set(j, A1.get(j) * T(0.01));
+    HypercomplexArray<T, dim> exponent = exp(scaled);
+    std::vector<T> norm = A1.norm();
+    for (std::size_t j=0; j < size; j++) {
+        const Hypercomplex<T, dim> h1 = A1.get(j), h2 = A2.get(j);
+        if (!identical(sum.get(j), Hypercomplex<T, dim>(h1 + h2)))
+            return false;
+        if (!identical(difference.get(j), Hypercomplex<T, dim>(h1 - h2)))
+            return false;
+        if (!identical(product.get(j), h1 * h2)) return false;
+        if (!identical(conjugate.get(j), Hypercomplex<T, dim>(~h1)))
+            return false;
+        if (!identical(inverse.get(j), h1.inv())) return false;
+        if (!identical(exponent.get(j), exp(scaled.get(j)))) return false;
+        if (norm[j] != h1.norm()) return false;
+    }
+    return true;
+}
+
+// error of a in units in the last place of the exact value
+template<typename T>
+double ulp_error(const T a, const mpfr_t exact) {
+    if (!mpfr_number_p(exact)) {
+        mpfr_t e;
+        mpfr_init2(e, 64);
+        mpfr_set_d(e, a, MPFR_RNDN);
+        const bool same = mpfr_equal_p(e, exact) ||
+            (mpfr_nan_p(e) && mpfr_nan_p(exact));
+        mpfr_clear(e);
+        return same ? 0.0 : 1e300;
+    }
+    long exponent = std::numeric_limits<T>::min_exponent;
+    if (!mpfr_zero_p(exact))
+        exponent = std::max(exponent, static_cast<long>(mpfr_get_exp(exact)));
+    mpfr_t e;
+    mpfr_init2(e, 1000);
+    mpfr_set_d(e, a, MPFR_RNDN);
+    mpfr_sub(e, e, exact, MPFR_RNDN);
+    mpfr_mul_2si(e, e, std::numeric_limits<T>::digits - exponent, MPFR_RNDN);
+    const double ulps = std::fabs(mpfr_get_d(e, MPFR_RNDN));
+    mpfr_clear(e);
+    return ulps == ulps ? ulps : 1e300;
+}
+
+// largest errors of the vectorised exp, log, sin, cos and atan2 over
+// pseudo-random arguments, including subnormal and large ones
+template<typename T>
+std::vector<double> vector_math_max_errors(unsigned int seed) {
+    using VM = VectorMath<T>;
+    auto uniform = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return static_cast<int>(seed >> 8) / 16777216.0;
+    };
+    const int lowest = std::numeric_limits<T>::min_exponent -
+        std::numeric_limits<T>::digits;
+    const int highest = std::numeric_limits<T>::max_exponent;
+    mpfr_t a, b, r, c;
+    mpfr_inits2(1000, a, b, r, c, static_cast<mpfr_ptr>(0));
+    std::vector<double> errors(5, 0.0);
+    for (unsigned int k=0; k < 2000; k++) {
+        // exp over the whole range of finite results
+        T x = static_cast<T>(
+            (lowest - 1 + (highest - lowest + 1) * uniform()) * std::log(2.0));
+        mpfr_set_d(a, x, MPFR_RNDN);
+        mpfr_exp(r, a, MPFR_RNDN);
+        errors[0] = std::max(errors[0], ulp_error(VM::exp(x), r));
+        // log of positive numbers
+        x = static_cast<T>(std::ldexp(1 + uniform(),
+            lowest + static_cast<int>((highest - lowest) * uniform())));
+        mpfr_set_d(a, x, MPFR_RNDN);
+        mpfr_log(r, a, MPFR_RNDN);
+        errors[1] = std::max(errors[1], ulp_error(VM::log(x), r));
+        // sine and cosine up to sin_cos_max
+        x = static_cast<T>(std::ldexp(uniform() - 0.5,
+            1 + static_cast<int>(std::log2(VM::sin_cos_max) * uniform())));
+        mpfr_set_d(a, x, MPFR_RNDN);
+        mpfr_sin_cos(r, c, a, MPFR_RNDN);
+        T sin_x, cos_x;
+        VM::sin_cos(x, sin_x, cos_x);
+        errors[2] = std::max(errors[2], ulp_error(sin_x, r));
+        errors[3] = std::max(errors[3], ulp_error(cos_x, c));
+        // angles of the upper half-plane
+        const T y = static_cast<T>(
+            std::ldexp(uniform(), static_cast<int>(20 * uniform()) - 10));
+        x = static_cast<T>(
+            std::ldexp(uniform() - 0.5, static_cast<int>(20 * uniform()) - 10));
+        mpfr_set_d(a, y, MPFR_RNDN);
+        mpfr_set_d(b, x, MPFR_RNDN);
+        mpfr_atan2(r, a, b, MPFR_RNDN);
+        errors[4] = std::max(errors[4], ulp_error(VM::atan2(y, x), r));
+    }
+    mpfr_clears(a, b, r, c, static_cast<mpfr_ptr>(0));
+    return errors;
+}
+
+// compare the vectorised batch functions against exact values computed
+// in long double: every component is within 8 u of the magnitude the
+// error bound of the function refers to
+template<typename T, const unsigned int dim>
+bool batch_functions_within_tolerance(
+    const std::size_t size,
+    unsigned int seed
+) {
+    std::vector<Hypercomplex<T, dim>> H, E, L, S, P;
+    HypercomplexArray<T, dim> A(size);
+    for (std::size_t j=0; j < size; j++) {
+        std::vector<T> x, y;
+        random_operands<T, dim>(seed + j, x, y);
+        for (unsigned int i=0; i < dim; i++) x[i] = x[i] / 50;
+        if (j % 7 == 2)  // purely real numbers
+            for (unsigned int i=1; i < dim; i++) x[i] = -T();
+        H.emplace_back(x.data());
+        E.push_back(H[j]);
+        A.set(j, H[j]);
+    }
+    L = S = P = E;
+    const T p = T(-2.5);
+    batch_exp(H.data(), E.data(), size);
+    batch_log(H.data(), L.data(), size);
+    batch_sqrt(H.data(), S.data(), size);
+    batch_pow(H.data(), p, P.data(), size);
+    const HypercomplexArray<T, dim> AE = batch_exp(A), AL = batch_log(A);
+    const HypercomplexArray<T, dim> AS = batch_sqrt(A), AP = batch_pow(A, p);
+    // both layouts give the same results, NaN included
+    auto same = [](
+        const Hypercomplex<T, dim> &h1,
+        const Hypercomplex<T, dim> &h2
+    ) {
+        for (unsigned int i=0; i < dim; i++)
+            if (!(h1[i] == h2[i] || (std::isnan(h1[i]) && std::isnan(h2[i]))))
+                return false;
+        return true;
+    };
+    long double exact[dim];
+    auto norm = [&exact]() {
+        long double norm2 = 0;
+        for (unsigned int i=0; i < dim; i++) norm2 += exact[i] * exact[i];
+        return std::sqrt(norm2);
+    };
+    auto within = [&exact](const Hypercomplex<T, dim> &h, long double scale) {
+        const long double u = std::numeric_limits<T>::epsilon() / 2;
+        for (unsigned int i=0; i < dim; i++)
+            if (!(std::fabs(h[i] - exact[i]) <= 8 * u * scale)) return false;
+        return true;
+    };
+    for (std::size_t j=0; j < size; j++) {
+        if (!same(AE.get(j), E[j]) || !same(AL.get(j), L[j])) return false;
+        if (!same(AS.get(j), S[j]) || !same(AP.get(j), P[j])) return false;
+        long double a[dim], v2 = 0;
+        for (unsigned int i=0; i < dim; i++) a[i] = H[j][i];
+        for (unsigned int i=1; i < dim; i++) v2 += a[i] * a[i];
+        const long double v = std::sqrt(v2);
+        const long double r = std::sqrt(a[0] * a[0] + v2);
+        const long double phi = std::atan2(v, a[0]);
+        if (dim == 1 && a[0] < 0) {
+            if (!std::isnan(L[j][0]) || !std::isnan(S[j][0])) return false;
+            if (!std::isnan(P[j][0])) return false;
+            continue;
+        }
+        // polar form m (cos(angle) + u sin(angle)), u along e_1 if v = 0
+        auto polar = [&](long double m, long double angle) {
+            exact[0] = m * std::cos(angle);
+            for (unsigned int i=1; i < dim; i++)
+                exact[i] = v == 0 ? 0 : a[i] * m * std::sin(angle) / v;
+            if (dim > 1 && v == 0) exact[1] = m * std::sin(angle);
+        };
+        polar(std::exp(a[0]), v);
+        if (!within(E[j], norm() * std::max(1.0L, v))) return false;
+        exact[0] = std::log(r);
+        for (unsigned int i=1; i < dim; i++)
+            exact[i] = v == 0 ? 0 : a[i] * phi / v;
+        if (dim > 1 && v == 0) exact[1] = phi;
+        if (!within(L[j], std::max(1.0L, norm()))) return false;
+        polar(std::sqrt(r), phi / 2);
+        if (!within(S[j], norm())) return false;
+        polar(std::pow(r, p), p * phi);
+        const long double condition = 1 + std::fabs(p * std::log(r)) +
+            std::fabs(p * phi);
+        if (!within(P[j], norm() * condition)) return false;
+    }
+    return true;
+}
 
 TEMPLATE_LIST_TEST_CASE( "Class Structure", "[unit]", TestTypes ) {
     //
@@ -108,6 +673,89 @@ TEMPLATE_LIST_TEST_CASE( "Class Structure", "[unit]", TestTypes ) {
             REQUIRE( exp_h2[2] == 0.0 );
             REQUIRE( exp_h2[3] == 0.0 );
         }
+
+        SECTION( "Logarithm" ) {
+            Hypercomplex<TestType, dim> log_h1 = log(h1);
+            REQUIRE( log_h1[0] == Approx(0.896).epsilon(0.01) );
+            REQUIRE( log_h1[1] == Approx(1.029).epsilon(0.01) );
+            REQUIRE( log_h1[2] == 0.0 );
+            REQUIRE( log_h1[3] == Approx(-0.514).epsilon(0.01) );
+            Hypercomplex<TestType, dim> exp_log_h1 = exp(log_h1);
+            for (unsigned int i=0; i < dim; i++)
+                REQUIRE( exp_log_h1[i] == Approx(h1[i]).margin(1e-5) );
+            // negative numbers along the first imaginary unit
+            TestType B[] = {-4.0, 0.0, 0.0, 0.0};
+            Hypercomplex<TestType, dim> h2(B);
+            Hypercomplex<TestType, dim> log_h2 = log(h2);
+            REQUIRE( log_h2[0] == Approx(1.386).epsilon(0.01) );
+            REQUIRE( log_h2[1] == Approx(3.14159).epsilon(0.0001) );
+            REQUIRE( log_h2[2] == 0.0 );
+            REQUIRE( log_h2[3] == 0.0 );
+        }
+
+        SECTION( "Square root" ) {
+            Hypercomplex<TestType, dim> sqrt_h1 = sqrt(h1);
+            REQUIRE( sqrt_h1[0] == Approx(1.313).epsilon(0.01) );
+            REQUIRE( sqrt_h1[1] == Approx(0.761).epsilon(0.01) );
+            REQUIRE( sqrt_h1[2] == 0.0 );
+            REQUIRE( sqrt_h1[3] == Approx(-0.381).epsilon(0.01) );
+            Hypercomplex<TestType, dim> square = sqrt_h1 * sqrt_h1;
+            for (unsigned int i=0; i < dim; i++)
+                REQUIRE( square[i] == Approx(h1[i]).margin(1e-5) );
+            TestType B[] = {-4.0, 0.0, 0.0, 0.0};
+            Hypercomplex<TestType, dim> h2(B);
+            Hypercomplex<TestType, dim> sqrt_h2 = sqrt(h2);
+            REQUIRE( sqrt_h2[0] == 0.0 );
+            REQUIRE( sqrt_h2[1] == 2.0 );
+            REQUIRE( sqrt_h2[2] == 0.0 );
+            REQUIRE( sqrt_h2[3] == 0.0 );
+        }
+
+        SECTION( "Real and hypercomplex powers" ) {
+            Hypercomplex<TestType, dim> pow_h1 = pow(h1, TestType(2.0));
+            Hypercomplex<TestType, dim> square = h1 * h1;
+            for (unsigned int i=0; i < dim; i++)
+                REQUIRE( pow_h1[i] == Approx(square[i]).margin(1e-5) );
+            pow_h1 = pow(h1, TestType(0.5));
+            Hypercomplex<TestType, dim> sqrt_h1 = sqrt(h1);
+            for (unsigned int i=0; i < dim; i++)
+                REQUIRE( pow_h1[i] == Approx(sqrt_h1[i]).margin(1e-5) );
+            pow_h1 = pow(h1, TestType(0.0));
+            REQUIRE( pow_h1[0] == 1.0 );
+            REQUIRE( pow_h1[1] == 0.0 );
+            TestType B[] = {2.0, 0.0, 0.0, 0.0};
+            Hypercomplex<TestType, dim> h2(B);
+            pow_h1 = pow(h1, h2);
+            for (unsigned int i=0; i < dim; i++)
+                REQUIRE( pow_h1[i] == Approx(square[i]).margin(1e-5) );
+            // H1^H2 = exp(log(H1) H2)
+            pow_h1 = pow(h1, h1);
+            Hypercomplex<TestType, dim> reference = exp(log(h1) * h1);
+            for (unsigned int i=0; i < dim; i++)
+                REQUIRE( pow_h1[i] == Approx(reference[i]).margin(1e-5) );
+            REQUIRE( pow_h1[0] == Approx(-0.187).epsilon(0.01) );
+            // integral exponents go through operator^
+            REQUIRE( pow(h1, TestType(2.0)) == (h1 ^ 2) );
+            REQUIRE( pow(h1, TestType(-3.0)) == (h1 ^ -3) );
+            TestType C[] = {-2.0, 0.0, 0.0, 0.0};
+            pow_h1 = pow(Hypercomplex<TestType, dim>(C), TestType(2.0));
+            REQUIRE( pow_h1[0] == 4.0 );
+            for (unsigned int i=1; i < dim; i++) REQUIRE( pow_h1[i] == 0.0 );
+            // dimension 1: real powers of the base type
+            TestType C1[] = {-2.0}, D1[] = {2.0};
+            Hypercomplex1<TestType> c1(C1), d1(D1);
+            REQUIRE( pow(c1, TestType(2.0))[0] == 4.0 );
+            REQUIRE( pow(c1, TestType(3.0))[0] == -8.0 );
+            // zero to a negative power divides by zero
+            TestType Z[] = {0.0, 0.0, 0.0, 0.0};
+            Hypercomplex<TestType, dim> zero(Z);
+            REQUIRE( pow(zero, TestType(0.5)) == zero );
+            REQUIRE_THROWS_AS(pow(zero, TestType(-1.0)), std::invalid_argument);
+            REQUIRE_THROWS_AS(pow(zero, TestType(-0.5)), std::invalid_argument);
+            REQUIRE(
+                pow(d1, TestType(0.5))[0] == Approx(1.41421356).epsilon(1e-6)
+            );
+        }
     }
 
     SECTION( "Main constructor: exception" ) {
@@ -135,6 +783,33 @@ TEMPLATE_LIST_TEST_CASE( "Class Structure", "[unit]", TestTypes ) {
         REQUIRE( h1[0] == h2[0] );
         REQUIRE( h2[0] == h3[0] );
         REQUIRE( h3[0] == h1[0] );
+        // components are stored inline:
+        REQUIRE( std::is_trivially_copyable<Hypercomplex<TestType, dim>>::value );
+        REQUIRE( sizeof(h1) == dim * sizeof(TestType) );
+    }
+
+    SECTION( "Move constructor" ) {
+        const unsigned int dim = 4;
+        TestType A[] = {1.0, 2.0, 0.0, -1.0};
+        TestType B[] = {-0.5, 1.0, 0.0, 6.0};
+        Hypercomplex<TestType, dim> h1(A);
+        Hypercomplex<TestType, dim> h2(std::move(h1));
+        REQUIRE( h2[0] == 1.0 );
+        REQUIRE( h2[3] == -1.0 );
+        Hypercomplex<TestType, dim> h3(B);
+        h3 = std::move(h2);
+        REQUIRE( h3[0] == 1.0 );
+        REQUIRE( h3[3] == -1.0 );
+        REQUIRE(
+            std::is_nothrow_move_constructible<
+                Hypercomplex<TestType, dim>
+            >::value
+        );
+        REQUIRE(
+            std::is_nothrow_move_assignable<
+                Hypercomplex<TestType, dim>
+            >::value
+        );
     }
 
     SECTION( "Destructor" ) {
@@ -252,6 +927,12 @@ TEMPLATE_LIST_TEST_CASE( "Overloading Operators", "[unit]", TestTypes ) {
         REQUIRE( h1[1] == 3.0 );
         REQUIRE( h1[2] == 0.0 );
         REQUIRE( h1[3] == 5.0 );
+        // expressions, including the caller itself
+        h1 += h1 - h2;
+        REQUIRE( h1[0] == 1.5 );
+        REQUIRE( h1[1] == 5.0 );
+        REQUIRE( h1[2] == 0.0 );
+        REQUIRE( h1[3] == 4.0 );
     }
 
     SECTION( "Subtraction-Assignment operator" ) {
@@ -260,6 +941,9 @@ TEMPLATE_LIST_TEST_CASE( "Overloading Operators", "[unit]", TestTypes ) {
         REQUIRE( h1[1] == 1.0 );
         REQUIRE( h1[2] == 0.0 );
         REQUIRE( h1[3] == -7.0 );
+        h1 -= -h1;
+        REQUIRE( h1[0] == 3.0 );
+        REQUIRE( h1[3] == -14.0 );
     }
 
     SECTION( "Multiplication operator" ) {
@@ -276,11 +960,42 @@ TEMPLATE_LIST_TEST_CASE( "Overloading Operators", "[unit]", TestTypes ) {
         REQUIRE( h1[1] == 0.0 );
         REQUIRE( h1[2] == -13.0 );
         REQUIRE( h1[3] == 6.5 );
+        // the caller is also the RHS operand
+        Hypercomplex<TestType, dim4> h = h2 * h2;
+        h2 *= h2;
+        REQUIRE( h2 == h );
     }
 
     SECTION( "Power operator" ) {
-        REQUIRE_THROWS_AS(h1 ^ 0, std::invalid_argument);
-        REQUIRE_NOTHROW(h1 ^ 1);
+        Hypercomplex<TestType, dim4> h0 = h1 ^ 0;
+        REQUIRE( h0[0] == 1.0 );
+        REQUIRE( h0[1] == 0.0 );
+        REQUIRE( h0[2] == 0.0 );
+        REQUIRE( h0[3] == 0.0 );
+        REQUIRE( (h1 ^ 1) == h1 );
+        // repeated squaring agrees with iterative multiplication
+        // (components may cancel, hence a margin relative to the norm)
+        Hypercomplex<TestType, dim4> hn(h0);
+        for (unsigned int n=1; n <= 20; n++) {
+            hn = hn * h1;
+            Hypercomplex<TestType, dim4> hp = h1 ^ n;
+            const double margin = 1e-4 * static_cast<double>(hn.norm());
+            for (unsigned int i=0; i < dim4; i++) {
+                REQUIRE(
+                    hp[i] == Approx(hn[i]).epsilon(1e-4).margin(margin)
+                );
+            }
+        }
+        // negative powers raise the inverse
+        Hypercomplex<TestType, dim4> hi = h1 ^ -3;
+        Hypercomplex<TestType, dim4> hi_ = (h1 ^ 3).inv();
+        const double margin = 1e-4 * static_cast<double>(hi_.norm());
+        for (unsigned int i=0; i < dim4; i++)
+            REQUIRE( hi[i] == Approx(hi_[i]).epsilon(1e-4).margin(margin) );
+        REQUIRE( (h1 ^ -1) == h1.inv() );
+        // large powers of a unit number stay on the unit sphere
+        Hypercomplex<TestType, dim4> u = h1 * TestType(1.0 / h1.norm());
+        REQUIRE( (u ^ 5000).norm() == Approx(1.0).epsilon(1e-2) );
         Hypercomplex<TestType, dim4> h = h1 ^ 2;
         REQUIRE( h[0] == -4.0 );
         REQUIRE( h[1] == 4.0 );
@@ -306,7 +1021,11 @@ TEMPLATE_LIST_TEST_CASE( "Overloading Operators", "[unit]", TestTypes ) {
     }
 
     SECTION( "Power-Assignment operator" ) {
-        REQUIRE_THROWS_AS(h1 ^= 0, std::invalid_argument);
+        Hypercomplex<TestType, dim4> h_ = h2 ^ -2;
+        h2 ^= -2;
+        REQUIRE( h2 == h_ );
+        h2 ^= 0;
+        REQUIRE( h2 == (h1 ^ 0) );
         REQUIRE_NOTHROW(h1 ^= 1);
         h1 ^= 2;
         REQUIRE( h1[0] == -4.0 );
@@ -360,6 +1079,19 @@ TEMPLATE_LIST_TEST_CASE( "Overloading Operators", "[unit]", TestTypes ) {
         TestType D[] = {0.0, 0.0, 0.0, 0.0};
         Hypercomplex<TestType, dim4> h4(D);
         REQUIRE_THROWS_AS(h1 /= h4, std::invalid_argument);
+        Hypercomplex<TestType, dim4> h = h2 / h1;
+        h2 /= h1;
+        REQUIRE( h2 == h );
+        // the fused quotient agrees with multiplication by the inverse
+        Hypercomplex<TestType, dim4> hi = h1 * h2.inv();
+        h = h1 / h2;
+        for (unsigned int i=0; i < dim4; i++)
+            REQUIRE( h[i] == Approx(hi[i]).epsilon(1e-5).margin(1e-6) );
+        // an operand may be divided by itself
+        h2 /= h2;
+        REQUIRE( h2[0] == Approx(1.0).epsilon(1e-6) );
+        for (unsigned int i=1; i < dim4; i++)
+            REQUIRE( h2[i] == Approx(0.0).margin(1e-6) );
     }
 
     SECTION( "Output stream operator" ) {
@@ -367,7 +1099,7 @@ TEMPLATE_LIST_TEST_CASE( "Overloading Operators", "[unit]", TestTypes ) {
     }
 }
 
-TEMPLATE_LIST_TEST_CASE( "Special", "[usecase]", TestTypes ) {
+TEMPLATE_LIST_TEST_CASE( "Special", "[usecase]", BuiltinTypes ) {
     //
     SECTION( "Multiplication optimization" ) {
         TestType A[] = {1.51, -1.13, 2.28, -10.77, -2.63, -9.11, 0.01, 4.02};
@@ -380,6 +1112,102 @@ TEMPLATE_LIST_TEST_CASE( "Special", "[usecase]", TestTypes ) {
         REQUIRE( true == true );
     }
 
+    SECTION( "Multiplication table" ) {
+        for (unsigned int seed=1; seed < 20; seed++) {
+            REQUIRE( multiplication_matches_reference<TestType, 1>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 2>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 4>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 8>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 16>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 32>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 64>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 128>(seed) );
+            REQUIRE( multiplication_matches_reference<TestType, 256>(seed) );
+        }
+    }
+
+    SECTION( "Multiplication kernels" ) {
+        for (unsigned int seed=1; seed < 100; seed++) {
+            REQUIRE( multiplication_within_tolerance<TestType, 1>(seed) );
+            REQUIRE( multiplication_within_tolerance<TestType, 2>(seed) );
+            REQUIRE( multiplication_within_tolerance<TestType, 4>(seed) );
+            REQUIRE( multiplication_within_tolerance<TestType, 8>(seed) );
+            REQUIRE( multiplication_within_tolerance<TestType, 16>(seed) );
+        }
+        // small integers: every kernel is exact
+        TestType A[] = {1.0, -2.0, 3.0, 0.0, -5.0, 6.0, 7.0, -8.0};
+        TestType B[] = {-4.0, 3.0, 0.0, 2.0, 1.0, -1.0, 9.0, 5.0};
+        TestType C4[4], C8[8];
+        cayley_dickson_multiply<TestType, 4>(A, B, C4);
+        cayley_dickson_multiply<TestType, 8>(A, B, C8);
+        REQUIRE( Hypercomplex<TestType, 4>(A) * Hypercomplex<TestType, 4>(B)
+            == Hypercomplex<TestType, 4>(C4) );
+        REQUIRE( Hypercomplex<TestType, 8>(A) * Hypercomplex<TestType, 8>(B)
+            == Hypercomplex<TestType, 8>(C8) );
+    }
+
+    SECTION( "Expression templates" ) {
+        TestType A[] = {1.0, 2.0, 0.0, -1.0};
+        TestType B[] = {-0.5, 1.0, 0.0, 6.0};
+        TestType C[] = {2.0, -3.0, 4.0, 0.5};
+        Hypercomplex<TestType, 4> h1(A);
+        Hypercomplex<TestType, 4> h2(B);
+        Hypercomplex<TestType, 4> h3(C);
+        // component-wise operations are lazy
+        REQUIRE_FALSE((
+            std::is_same<decltype(h1 + h2), Hypercomplex<TestType, 4>>::value
+        ));
+        // a whole chain is evaluated in a single pass
+        Hypercomplex<TestType, 4> h = h1 + h2 - ~h3 + (-h1) * TestType(2.0);
+        for (unsigned int i=0; i < 4; i++) {
+            TestType c = i ? -C[i] : C[i];
+            REQUIRE( h[i] == A[i] + B[i] - c + TestType(2.0) * -A[i] );
+        }
+        h = TestType(0.5) * (h1 - h2);
+        for (unsigned int i=0; i < 4; i++)
+            REQUIRE( h[i] == TestType(0.5) * (A[i] - B[i]) );
+        // operands may alias the assigned object
+        h1 = h2 - h1;
+        for (unsigned int i=0; i < 4; i++) REQUIRE( h1[i] == B[i] - A[i] );
+        h1 = Hypercomplex<TestType, 4>(A);
+        // temporary numbers are held by value, named ones by reference,
+        // so a stored expression may outlive the temporaries
+        REQUIRE((
+            std::is_same<decltype((h1 * h2) + h3), HypercomplexSum<
+                Hypercomplex<TestType, 4>, const Hypercomplex<TestType, 4>&,
+                TestType, 4
+            >>::value
+        ));
+        auto s = (h1 * h2) + TestType(2.0) * (h2 * h1) - ~(h3 * h1);
+        auto n = -(h1 * h3) * TestType(0.5);
+        Hypercomplex<TestType, 4> p12 = h1 * h2, p21 = h2 * h1;
+        Hypercomplex<TestType, 4> p31 = h3 * h1, p13 = h1 * h3;
+        REQUIRE( s == p12 + TestType(2.0) * p21 - ~p31 );
+        REQUIRE( n == -p13 * TestType(0.5) );
+        // non-lazy operations accept expressions
+        Hypercomplex<TestType, 4> h12(h1 + h2);
+        REQUIRE( (h1 + h2) * h3 == h12 * h3 );
+        REQUIRE( h3 / (h1 + h2) == h3 / h12 );
+        REQUIRE( ((h1 + h2) ^ 3) == (h12 ^ 3) );
+        REQUIRE( exp(h1 + h2) == exp(h12) );
+        REQUIRE( log(h1 + h2) == log(h12) );
+        REQUIRE( sqrt(h1 + h2) == sqrt(h12) );
+        REQUIRE( pow(h1 + h2, TestType(0.5)) == pow(h12, TestType(0.5)) );
+        REQUIRE( pow(h1 + h2, h1 - h2) == pow(h12, h1 - h2) );
+        REQUIRE( Re(h1 + h2) == Re(h12) );
+        REQUIRE( Im(h1 + h2) == Im(h12) );
+        REQUIRE( (h1 + h2).norm() == h12.norm() );
+        REQUIRE( (h1 + h2).inv() == h12.inv() );
+        REQUIRE( (h1 + h2)._() == 4 );
+        REQUIRE( (h1 + h2).template expand<8>() == h12.template expand<8>() );
+        // compound assignments on temporary expressions return the result
+        REQUIRE( ((h1 + h2) += h3) == h12 + h3 );
+        REQUIRE( ((h1 + h2) -= h3) == h12 - h3 );
+        REQUIRE( ((h1 + h2) *= h3) == h12 * h3 );
+        REQUIRE( ((h1 + h2) /= h3) == h12 / h3 );
+        REQUIRE( ((h1 + h2) ^= 3) == (h12 ^ 3) );
+    }
+
     SECTION( "Const objects" ) {
         const unsigned int dim = 4;
         const unsigned int cui = 2;
@@ -404,6 +1232,225 @@ TEMPLATE_LIST_TEST_CASE( "Special", "[usecase]", TestTypes ) {
         REQUIRE_NOTHROW(Re(const_h1));
         REQUIRE_NOTHROW(Im(const_h1));
         REQUIRE_NOTHROW(exp(const_h1));
+        REQUIRE_NOTHROW(log(const_h1));
+        REQUIRE_NOTHROW(sqrt(const_h1));
+        REQUIRE_NOTHROW(pow(const_h1, TestType(0.5)));
+        REQUIRE_NOTHROW(pow(const_h1, const_h2));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE( "Structure of arrays", "[unit]", TestTypes ) {
+    //
+    SECTION( "Element access" ) {
+        HypercomplexArray<TestType, 4> A(37);
+        REQUIRE( A.size() == 37 );
+        REQUIRE( A._() == 4 );
+        TestType X[] = {1.0, 2.0, 0.0, -1.0};
+        Hypercomplex<TestType, 4> h(X);
+        REQUIRE( A.get(5)[0] == 0.0 );
+        A.set(5, h);
+        REQUIRE( A.get(5) == h );
+        REQUIRE( A.lane(3)[5] == -1.0 );
+        for (unsigned int i=0; i < 4; i++)
+            REQUIRE( reinterpret_cast<std::uintptr_t>(A.lane(i)) % 64 == 0 );
+        REQUIRE_THROWS_AS(A.get(37), std::out_of_range);
+        REQUIRE_THROWS_AS(A.set(37, h), std::out_of_range);
+        HypercomplexArray<TestType, 4> B(A);
+        REQUIRE( B.get(5) == h );
+        HypercomplexArray<TestType, 4> C(1);
+        C = A;
+        REQUIRE( C.size() == 37 );
+        REQUIRE( C.get(5) == h );
+        HypercomplexArray<TestType, 4> D(std::move(C));
+        REQUIRE( D.get(5) == h );
+        REQUIRE( C.size() == 0 );
+        REQUIRE_THROWS_AS(
+            (HypercomplexArray<TestType, 3>(1)),
+            std::invalid_argument
+        );
+    }
+
+    SECTION( "Bulk operations" ) {
+        for (unsigned int seed=1; seed < 4; seed++) {
+            REQUIRE( array_matches_elements<TestType, 1>(300, seed) );
+            REQUIRE( array_matches_elements<TestType, 2>(300, seed) );
+            REQUIRE( array_matches_elements<TestType, 4>(300, seed) );
+            REQUIRE( array_matches_elements<TestType, 8>(300, seed) );
+            REQUIRE( array_matches_elements<TestType, 16>(13, seed) );
+            REQUIRE( array_matches_elements<TestType, 64>(5, seed) );
+        }
+    }
+
+    SECTION( "Exceptions" ) {
+        HypercomplexArray<TestType, 4> A(3), B(4);
+        REQUIRE_THROWS_AS(A + B, std::invalid_argument);
+        REQUIRE_THROWS_AS(A - B, std::invalid_argument);
+        REQUIRE_THROWS_AS(A * B, std::invalid_argument);
+        REQUIRE_THROWS_AS(A.inv(), std::invalid_argument);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE( "Parallel batch operations", "[unit]", TestTypes ) {
+    //
+    const std::size_t n = 1000;
+    std::vector<Hypercomplex<TestType, 4>> H1, H2, out;
+    for (std::size_t j=0; j < n; j++) {
+        std::vector<TestType> x, y;
+        random_operands<TestType, 4>(j + 1, x, y);
+        for (unsigned int i=0; i < 4; i++) x[i] = x[i] / 100;
+        y[0] = y[0] + 1;  // no zero divisors
+        H1.emplace_back(x.data());
+        H2.emplace_back(y.data());
+        out.emplace_back(x.data());
+    }
+    std::vector<TestType> norm(n);
+    // (a grain of SIZE_MAX must not overflow into zero chunks)
+    const std::size_t all = std::numeric_limits<std::size_t>::max();
+    std::vector<ParallelOptions> settings = {
+        {}, {1, 0}, {3, 1}, {4, 7}, {4, all}
+    };
+    for (const ParallelOptions &options : settings) {
+        parallel_multiply(H1.data(), H2.data(), out.data(), n, options);
+        for (std::size_t j=0; j < n; j++) REQUIRE( out[j] == H1[j] * H2[j] );
+        parallel_divide(H1.data(), H2.data(), out.data(), n, options);
+        for (std::size_t j=0; j < n; j++) REQUIRE( out[j] == H1[j] / H2[j] );
+        parallel_exp(H1.data(), out.data(), n, options);
+        for (std::size_t j=0; j < n; j++) REQUIRE( out[j] == exp(H1[j]) );
+        parallel_norm(H1.data(), norm.data(), n, options);
+        for (std::size_t j=0; j < n; j++) REQUIRE( norm[j] == H1[j].norm() );
+    }
+    // results may overwrite the operands
+    std::vector<Hypercomplex<TestType, 4>> H(H1);
+    parallel_multiply(H.data(), H2.data(), H.data(), n);
+    for (std::size_t j=0; j < n; j++) REQUIRE( H[j] == H1[j] * H2[j] );
+    // exceptions of the workers are passed to the caller
+    TestType zero[] = {0.0, 0.0, 0.0, 0.0};
+    H2[n / 2] = Hypercomplex<TestType, 4>(zero);
+    REQUIRE_THROWS_AS(
+        parallel_divide(H1.data(), H2.data(), out.data(), n, {4, 10}),
+        std::invalid_argument
+    );
+    REQUIRE_NOTHROW(parallel_exp(H1.data(), out.data(), 0));
+    // worker threads are kept between calls; every call below needs a
+    // worker, as the caller waits on the first chunk for the second one
+    static std::atomic<unsigned int> created(0);
+    std::atomic<unsigned int> started(0);
+    std::vector<unsigned int> workers;
+    std::mutex workers_mutex;
+    const std::thread::id caller = std::this_thread::get_id();
+    const unsigned int most =
+        std::max(std::thread::hardware_concurrency(), 4u);
+    for (unsigned int call=0; call < 2 * most; call++) {
+        started = 0;
+        parallel_for<TestType>(2, {2, 1}, [&](std::size_t begin, std::size_t) {
+            started++;
+            if (begin == 0) {
+                for (unsigned int k=0; k < 1000 && started < 2; k++)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if (std::this_thread::get_id() == caller) return;
+            thread_local const unsigned int token = ++created;
+            std::lock_guard<std::mutex> lock(workers_mutex);
+            if (std::count(workers.begin(), workers.end(), token) == 0)
+                workers.push_back(token);
+        });
+    }
+    REQUIRE( !workers.empty() );
+    REQUIRE( workers.size() < most );
+    // a call from inside a job runs on the calling thread
+    std::atomic<std::size_t> inner(0);
+    parallel_for<TestType>(4, {2, 1}, [&](std::size_t, std::size_t) {
+        parallel_for<TestType>(8, {2, 1}, [&](std::size_t b, std::size_t e) {
+            inner += e - b;
+        });
+    });
+    REQUIRE( inner == 32 );
+}
+
+TEMPLATE_LIST_TEST_CASE(
+    "Vectorised batch functions", "[unit]", VectorisedTypes
+) {
+    //
+    SECTION( "Elementary functions" ) {
+        // exp, log, sin, cos, atan2
+        const double bounds[] = {2.0, 1.0, 3.0, 3.0, 3.0};
+        for (unsigned int seed=1; seed < 3; seed++) {
+            std::vector<double> errors =
+                vector_math_max_errors<TestType>(seed);
+            for (unsigned int f=0; f < 5; f++)
+                REQUIRE( errors[f] <= bounds[f] );
+        }
+        using VM = VectorMath<TestType>;
+        const TestType inf = std::numeric_limits<TestType>::infinity();
+        const TestType nan = std::numeric_limits<TestType>::quiet_NaN();
+        REQUIRE( VM::exp(inf) == inf );
+        REQUIRE( VM::exp(-inf) == 0.0 );
+        REQUIRE( VM::exp(0.0) == 1.0 );
+        REQUIRE( std::isnan(VM::exp(nan)) );
+        REQUIRE( VM::log(0.0) == -inf );
+        REQUIRE( VM::log(1.0) == 0.0 );
+        REQUIRE( VM::log(inf) == inf );
+        REQUIRE( std::isnan(VM::log(-1.0)) );
+        REQUIRE( VM::atan2(0.0, 0.0) == 0.0 );
+        const TestType pi = static_cast<TestType>(std::acos(-1.0));
+        REQUIRE( VM::atan2(0.0, -1.0) == pi );
+        REQUIRE( VM::atan2(inf, inf) == pi / 4 );
+    }
+
+    SECTION( "Accuracy" ) {
+        for (unsigned int seed=1; seed < 4; seed++) {
+            REQUIRE( batch_functions_within_tolerance<TestType, 1>(300, seed) );
+            REQUIRE( batch_functions_within_tolerance<TestType, 2>(300, seed) );
+            REQUIRE( batch_functions_within_tolerance<TestType, 4>(300, seed) );
+            REQUIRE( batch_functions_within_tolerance<TestType, 8>(300, seed) );
+            REQUIRE( batch_functions_within_tolerance<TestType, 16>(40, seed) );
+            REQUIRE( batch_functions_within_tolerance<TestType, 64>(5, seed) );
+        }
+    }
+
+    SECTION( "Special values" ) {
+        const TestType pi = static_cast<TestType>(std::acos(-1.0));
+        TestType X[] = {-4.0, 0.0, 0.0, 0.0}, Y[] = {1.0, 0.0, 0.0, 0.0};
+        TestType Z[] = {0.0, 0.0, 0.0, 0.0};
+        const Hypercomplex<TestType, 4> one(Y), zero(Z);
+        Hypercomplex<TestType, 4> h(X), out(X);
+        batch_sqrt(&h, &out, 1);
+        REQUIRE( out[0] == 0.0 );
+        REQUIRE( out[1] == 2.0 );
+        batch_log(&h, &out, 1);
+        REQUIRE( out[1] == pi );
+        batch_pow(&h, TestType(0.0), &out, 1);
+        REQUIRE( out == one );
+        batch_exp(&zero, &out, 1);
+        REQUIRE( out == one );
+        batch_log(&zero, &out, 1);
+        REQUIRE( out[0] == -std::numeric_limits<TestType>::infinity() );
+        batch_sqrt(&zero, &out, 1);
+        REQUIRE( out == zero );
+        // zero to a negative power divides by zero, nothing is written
+        out = h;
+        REQUIRE_THROWS_AS(
+            batch_pow(&zero, TestType(-0.5), &out, 1), std::invalid_argument
+        );
+        REQUIRE( out == h );
+        HypercomplexArray<TestType, 4> A(2);
+        A.set(0, h);
+        REQUIRE_THROWS_AS(batch_pow(A, TestType(-1.0)), std::invalid_argument);
+        REQUIRE_NOTHROW(batch_exp(&h, &out, 0));
+    }
+
+    SECTION( "Results overwriting the operands" ) {
+        std::vector<Hypercomplex<TestType, 8>> H, out;
+        for (unsigned int j=0; j < 1000; j++) {
+            std::vector<TestType> x, y;
+            random_operands<TestType, 8>(j + 1, x, y);
+            H.emplace_back(x.data());
+        }
+        out = H;
+        batch_log(H.data(), out.data(), H.size());
+        batch_log(H.data(), H.data(), H.size());
+        for (std::size_t j=0; j < H.size(); j++)
+            REQUIRE( identical(H[j], out[j]) );
     }
 }
 
@@ -471,6 +1518,225 @@ TEST_CASE( "Expansion", "[unit]" ) {
     clear_mpfr_memory();
 }
 
+TEST_CASE( "Reduced multiplication", "[unit]" ) {
+
+    SECTION( "Accuracy" ) {
+        for (unsigned int seed=1; seed < 20; seed++) {
+            REQUIRE( reduced_within_tolerance<double, 1>(seed) );
+            REQUIRE( reduced_within_tolerance<double, 2>(seed) );
+            REQUIRE( reduced_within_tolerance<double, 4>(seed) );
+            REQUIRE( reduced_within_tolerance<double, 8>(seed) );
+            REQUIRE( reduced_within_tolerance<float, 16>(seed) );
+            REQUIRE( reduced_within_tolerance<double, 64>(seed) );
+        }
+    }
+
+    SECTION( "Selection by the base type" ) {
+        // 3 multiplications for complex numbers; 8 and a halving
+        // for quaternions, 4 quaternion products per octonion
+        std::vector<double> x, y;
+        random_operands<double, 8>(5, x, y);
+        CountedDouble X[8], Y[8];
+        for (unsigned int i=0; i < 8; i++) {
+            X[i] = x[i];
+            Y[i] = y[i];
+        }
+        CountedDouble::multiplications = 0;
+        Hypercomplex<CountedDouble, 2> c = Hypercomplex<CountedDouble, 2>(X) *
+            Hypercomplex<CountedDouble, 2>(Y);
+        REQUIRE( CountedDouble::multiplications == 3 );
+        REQUIRE( c[0].v == x[0] * y[0] - x[1] * y[1] );
+        CountedDouble::multiplications = 0;
+        Hypercomplex<CountedDouble, 4> q(X);
+        q *= Hypercomplex<CountedDouble, 4>(Y);
+        REQUIRE( CountedDouble::multiplications == 9 );
+        CountedDouble::multiplications = 0;
+        Hypercomplex<CountedDouble, 8> h1(X), h2(Y);
+        Hypercomplex<CountedDouble, 8> o = h1 * h2;
+        REQUIRE( CountedDouble::multiplications == 36 );
+        std::vector<double> reference = cayley_dickson_product(x, y);
+        for (unsigned int i=0; i < 8; i++)
+            REQUIRE( std::fabs(o[i].v - reference[i]) < 1e-9 );
+        HypercomplexArray<CountedDouble, 8> A1(3), A2(3);
+        for (std::size_t j=0; j < 3; j++) {
+            A1.set(j, h1);
+            A2.set(j, h2);
+        }
+        HypercomplexArray<CountedDouble, 8> A = A1 * A2;
+        for (unsigned int i=0; i < 8; i++) REQUIRE( A.get(2)[i].v == o[i].v );
+    }
+}
+
+TEST_CASE( "Double-double and quad-double", "[unit]" ) {
+
+    SECTION( "Accuracy against MPFR" ) {
+        for (unsigned int seed=1; seed < 4; seed++) {
+            REQUIRE( expansion_max_error<double_double>(seed) < -100 );
+            REQUIRE( expansion_max_error<quad_double>(seed) < -203 );
+        }
+    }
+
+    SECTION( "Special values" ) {
+        REQUIRE( sqrt(double_double()) == 0.0 );
+        REQUIRE( std::isnan(static_cast<double>(sqrt(quad_double(-1.0)))) );
+        REQUIRE( exp(quad_double()) == 1.0 );
+        REQUIRE( exp(double_double(-800.0)) == 0.0 );
+        REQUIRE( std::isinf(static_cast<double>(exp(double_double(710.0)))) );
+        REQUIRE( sin(double_double()) == 0.0 );
+        REQUIRE( cos(quad_double()) == 1.0 );
+        quad_double sin_3, cos_3;
+        sin_cos(quad_double(3.0), sin_3, cos_3);
+        REQUIRE( sin_3 == sin(quad_double(3.0)) );
+        REQUIRE( cos_3 == cos(quad_double(3.0)) );
+        REQUIRE( signbit(-quad_double()) );
+        REQUIRE( double_double(1.0, 0x1p-60) > double_double(1.0) );
+        REQUIRE( quad_double(1.0, 0.0, -0x1p-120, 0.0) < quad_double(1.0) );
+    }
+
+    SECTION( "Conjugate expressions" ) {
+        // GCC 12 at -O2 -mavx2 zeroed a component of ~h when the
+        // conjugate chose between -e[i] and e[i] in a vectorised loop
+        const unsigned int dim = 8;
+        unsigned int seed = 3;
+        double_double X[dim];
+        for (unsigned int i=0; i < dim; i++)
+            X[i] = expansion_operand<double_double>(seed, 10.0);
+        const Hypercomplex<double_double, dim> h(X);
+        const Hypercomplex<double_double, dim> c = ~h;
+        REQUIRE( c[0] == h[0] );
+        for (unsigned int i=1; i < dim; i++) REQUIRE( c[i] == -h[i] );
+    }
+
+    SECTION( "Decimal output" ) {
+        std::ostringstream os;
+        os.precision(30);
+        os << exp(double_double(1.0)) << " " << -quad_double(100.0);
+        REQUIRE( os.str() ==
+            "2.71828182845904523536028747135e+00 "
+            "-1.00000000000000000000000000000e+02" );
+        std::ostringstream os_short;
+        os_short << quad_double(0.5) << " " << double_double(9.9999999);
+        REQUIRE( os_short.str() == "5.00000e-01 1.00000e+01" );
+    }
+
+    SECTION( "Hypercomplex numbers" ) {
+        // octonions at 212 bits against MPFR at 300 bits
+        const unsigned int dim = 8;
+        unsigned int seed = 7;
+        quad_double X[dim], Y[dim];
+        mpfr_t A[dim], B[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            X[i] = expansion_operand<quad_double>(seed, 1.0);
+            Y[i] = expansion_operand<quad_double>(seed, 1.0);
+            mpfr_init2(A[i], 300);
+            mpfr_init2(B[i], 300);
+            expansion_to_mpfr(A[i], X[i]);
+            expansion_to_mpfr(B[i], Y[i]);
+        }
+        Hypercomplex<quad_double, dim> h1(X), h2(Y);
+        set_mpfr_precision(300);
+        Hypercomplex<mpfr_t, dim> m1(A), m2(B);
+        const Hypercomplex<quad_double, dim> results[] = {
+            h1 * h2, h1 / h2, exp(h1)
+        };
+        const Hypercomplex<mpfr_t, dim> exact[] = {m1 * m2, m1 / m2, exp(m1)};
+        mpfr_t norm, difference;
+        mpfr_inits2(300, norm, difference, static_cast<mpfr_ptr>(0));
+        for (unsigned int k=0; k < 3; k++) {
+            exact[k].norm(norm);
+            for (unsigned int i=0; i < dim; i++) {
+                expansion_to_mpfr(difference, results[k][i]);
+                mpfr_sub(difference, difference, exact[k][i], MPFR_RNDN);
+                mpfr_div(difference, difference, norm, MPFR_RNDN);
+                REQUIRE( mpfr_cmp_d(difference, 0x1p-200) < 0 );
+                REQUIRE( mpfr_cmp_d(difference, -0x1p-200) > 0 );
+            }
+        }
+        mpfr_clears(norm, difference, static_cast<mpfr_ptr>(0));
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_clear(A[i]);
+            mpfr_clear(B[i]);
+        }
+        clear_mpfr_memory();
+    }
+}
+
+#ifdef HYPERCOMPLEX_QUADMATH
+TEST_CASE( "__float128", "[unit]" ) {
+    using namespace hypercomplex_math;  // NOLINT
+
+    SECTION( "Accuracy against MPFR" ) {
+        for (unsigned int seed=1; seed < 4; seed++) {
+            REQUIRE( expansion_max_error<__float128>(seed) < -110 );
+        }
+    }
+
+    SECTION( "Special values" ) {
+        REQUIRE( sqrt(__float128(4)) == 2 );
+        REQUIRE( isnan(sqrt(__float128(-1))) );
+        REQUIRE( exp(__float128()) == 1 );
+        REQUIRE( log(__float128(1)) == 0 );
+        REQUIRE( pow(__float128(2), __float128(-3)) == 0.125 );
+        REQUIRE( signbit(-__float128()) );
+        REQUIRE( ldexp(__float128(1), -16000) > 0 );
+        REQUIRE( abs(__float128(-3)) == 3 );
+    }
+
+    SECTION( "Decimal output" ) {
+        std::ostringstream os;
+        os.precision(33);
+        os << exp(__float128(1)) << " " << -__float128(100);
+        REQUIRE( os.str() == "2.71828182845904523536028747135266 -100" );
+        std::ostringstream os_fixed;
+        os_fixed << std::fixed << std::setprecision(3) << std::setw(8);
+        os_fixed << __float128(2.5) << std::scientific;
+        os_fixed << " " << __float128(0.5);
+        REQUIRE( os_fixed.str() == "   2.500 5.000e-01" );
+    }
+
+    SECTION( "Hypercomplex numbers" ) {
+        // octonions at 113 bits against MPFR at 300 bits
+        const unsigned int dim = 8;
+        unsigned int seed = 7;
+        __float128 X[dim], Y[dim];
+        mpfr_t A[dim], B[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            X[i] = expansion_operand<__float128>(seed, 1.0);
+            Y[i] = expansion_operand<__float128>(seed, 1.0);
+            mpfr_init2(A[i], 300);
+            mpfr_init2(B[i], 300);
+            expansion_to_mpfr(A[i], X[i]);
+            expansion_to_mpfr(B[i], Y[i]);
+        }
+        Hypercomplex<__float128, dim> h1(X), h2(Y);
+        set_mpfr_precision(300);
+        Hypercomplex<mpfr_t, dim> m1(A), m2(B);
+        const Hypercomplex<__float128, dim> results[] = {
+            h1 * h2, h1 / h2, exp(h1)
+        };
+        const Hypercomplex<mpfr_t, dim> exact[] = {m1 * m2, m1 / m2, exp(m1)};
+        mpfr_t norm, difference;
+        mpfr_inits2(300, norm, difference, static_cast<mpfr_ptr>(0));
+        for (unsigned int k=0; k < 3; k++) {
+            exact[k].norm(norm);
+            for (unsigned int i=0; i < dim; i++) {
+                expansion_to_mpfr(difference, results[k][i]);
+                mpfr_sub(difference, difference, exact[k][i], MPFR_RNDN);
+                mpfr_div(difference, difference, norm, MPFR_RNDN);
+                REQUIRE( mpfr_cmp_d(difference, 0x1p-105) < 0 );
+                REQUIRE( mpfr_cmp_d(difference, -0x1p-105) > 0 );
+            }
+        }
+        mpfr_clears(norm, difference, static_cast<mpfr_ptr>(0));
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_clear(A[i]);
+            mpfr_clear(B[i]);
+        }
+        clear_mpfr_memory();
+    }
+}
+#endif
+
 TEST_CASE( "MPFR lib test", "[unit]" ) {
     //
     SECTION( "Main constructor & functions" ) {
@@ -663,6 +1929,50 @@ TEST_CASE( "MPFR lib test", "[unit]" ) {
         clear_mpfr_memory();
     }
 
+    SECTION( "Move constructor" ) {
+        set_mpfr_precision(200);
+        mpfr_t A[4];
+        mpfr_init2(A[0], MPFR_global_precision);
+        mpfr_init2(A[1], MPFR_global_precision);
+        mpfr_init2(A[2], MPFR_global_precision);
+        mpfr_init2(A[3], MPFR_global_precision);
+        mpfr_set_d(A[0], 1.0, MPFR_RNDN);
+        mpfr_set_d(A[1], 2.0, MPFR_RNDN);
+        mpfr_set_d(A[2], 0.0, MPFR_RNDN);
+        mpfr_set_d(A[3], -1.0, MPFR_RNDN);
+        Hypercomplex<mpfr_t, 4> h1(A);
+        Hypercomplex<mpfr_t, 4> h2(A);
+        Hypercomplex<mpfr_t, 4> h3(std::move(h1));
+        REQUIRE( mpfr_cmp_d(h3[0], 1.0) == 0 );
+        REQUIRE( mpfr_cmp_d(h3[3], -1.0) == 0 );
+        // a moved-from object may be reassigned:
+        h1 = h2;
+        REQUIRE( h1 == h2 );
+        h2 = std::move(h3);
+        REQUIRE( h1 == h2 );
+        // temporaries are reused in chained expressions:
+        Hypercomplex<mpfr_t, 4> h4 = h1 * h2 + h1 * h2 - h1;
+        Hypercomplex<mpfr_t, 4> h5 = h1 * h2;
+        h5 += h1 * h2;
+        h5 -= h1;
+        REQUIRE( h4 == h5 );
+        REQUIRE(
+            std::is_nothrow_move_constructible<
+                Hypercomplex<mpfr_t, 4>
+            >::value
+        );
+        REQUIRE(
+            std::is_nothrow_move_assignable<
+                Hypercomplex<mpfr_t, 4>
+            >::value
+        );
+        mpfr_clear(A[0]);
+        mpfr_clear(A[1]);
+        mpfr_clear(A[2]);
+        mpfr_clear(A[3]);
+        clear_mpfr_memory();
+    }
+
     SECTION( "Destructor" ) {
         const unsigned int dim = 4;
         set_mpfr_precision(200);
@@ -1047,6 +2357,12 @@ TEST_CASE( "MPFR lib test", "[unit]" ) {
             std::cout << std::endl;
             mpfr_out_str(stdout, 10, 0, h1[3], MPFR_RNDN);
             std::cout << std::endl;
+            Hypercomplex<mpfr_t, dim4> h = h2 * h2;
+            h2 *= h2;
+            REQUIRE( h2 == h );
+            h2 += h2;
+            h -= -h;
+            REQUIRE( h2 == h );
             mpfr_clear(A[0]);
             mpfr_clear(A[1]);
             mpfr_clear(A[2]);
@@ -1062,9 +2378,17 @@ TEST_CASE( "MPFR lib test", "[unit]" ) {
         }
 
         SECTION( "Power operator" ) {
-            REQUIRE_THROWS_AS(h1 ^ 0, std::invalid_argument);
+            Hypercomplex<mpfr_t, dim4> h0 = h1 ^ 0;
+            REQUIRE( mpfr_cmp_ui(h0[0], 1) == 0 );
+            REQUIRE( mpfr_zero_p(h0[1]) );
+            REQUIRE( mpfr_zero_p(h0[2]) );
+            REQUIRE( mpfr_zero_p(h0[3]) );
             REQUIRE_NOTHROW(h1 ^ 1);
             REQUIRE_NOTHROW(h1 ^ 2);
+            // integer components: all powers are exact at this precision
+            REQUIRE( (h1 ^ 5) == h1 * h1 * h1 * h1 * h1 );
+            REQUIRE( (h1 ^ 8) == ((h1 * h1) ^ 4) );
+            REQUIRE( (h1 ^ -1) == h1.inv() );
             mpfr_clear(A[0]);
             mpfr_clear(A[1]);
             mpfr_clear(A[2]);
@@ -1079,7 +2403,11 @@ TEST_CASE( "MPFR lib test", "[unit]" ) {
         }
 
         SECTION( "Power-Assignment operator" ) {
-            REQUIRE_THROWS_AS(h1 ^= 0, std::invalid_argument);
+            Hypercomplex<mpfr_t, dim4> h = h2 ^ 7;
+            h2 ^= 7;
+            REQUIRE( h2 == h );
+            h2 ^= 0;
+            REQUIRE( h2 == (h1 ^ 0) );
             REQUIRE_NOTHROW(h1 ^= 1);
             REQUIRE_NOTHROW(h1 ^= 2);
             mpfr_clear(A[0]);
@@ -1144,6 +2472,11 @@ TEST_CASE( "MPFR lib test", "[unit]" ) {
             std::cout << std::endl;
             mpfr_out_str(stdout, 10, 0, h1[3], MPFR_RNDN);
             std::cout << std::endl;
+            h2 /= h2;
+            REQUIRE( mpfr_cmp_ui(h2[0], 1) == 0 );
+            REQUIRE( mpfr_zero_p(h2[1]) );
+            REQUIRE( mpfr_zero_p(h2[2]) );
+            REQUIRE( mpfr_zero_p(h2[3]) );
             mpfr_t D[4];
             mpfr_init2(D[0], MPFR_global_precision);
             mpfr_init2(D[1], MPFR_global_precision);
@@ -1269,6 +2602,752 @@ TEST_CASE( "MPFR: const objects", "[unit]" ) {
     clear_mpfr_memory();
 }
 
+TEST_CASE( "MPFR: logarithm, square root and powers", "[unit]" ) {
+    set_mpfr_precision(200);
+    const unsigned int dim = 4;
+    const int values[] = {1, 2, 0, -1};
+    mpfr_t A[dim], B[dim], p, difference;
+    mpfr_inits2(200, p, difference, static_cast<mpfr_ptr>(0));
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_init2(A[i], 200);
+        mpfr_init2(B[i], 200);
+        mpfr_set_si(A[i], values[i], MPFR_RNDN);
+        mpfr_set_si(B[i], 0, MPFR_RNDN);
+    }
+    mpfr_set_si(B[0], -4, MPFR_RNDN);
+    Hypercomplex<mpfr_t, dim> h1(A), h2(B);
+    // every component within 2^-190 of the expected one
+    auto close = [&difference](
+        const Hypercomplex<mpfr_t, dim> &h,
+        const Hypercomplex<mpfr_t, dim> &expected
+    ) {
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_sub(difference, h[i], expected[i], MPFR_RNDN);
+            mpfr_abs(difference, difference, MPFR_RNDN);
+            if (mpfr_cmp_si_2exp(difference, 1, -190) >= 0) return false;
+        }
+        return true;
+    };
+
+    SECTION( "Logarithm" ) {
+        Hypercomplex<mpfr_t, dim> log_h1 = log(h1);
+        const double log_norm = mpfr_get_d(log_h1[0], MPFR_RNDN);
+        REQUIRE( log_norm == Approx(0.896).epsilon(0.01) );
+        REQUIRE( mpfr_zero_p(log_h1[2]) );
+        REQUIRE( close(exp(log_h1), h1) );
+        // negative numbers along the first imaginary unit
+        Hypercomplex<mpfr_t, dim> log_h2 = log(h2);
+        mpfr_const_pi(p, MPFR_RNDN);
+        REQUIRE( mpfr_equal_p(log_h2[1], p) );
+        REQUIRE( mpfr_zero_p(log_h2[2]) );
+        REQUIRE( close(exp(log_h2), h2) );
+    }
+
+    SECTION( "Square root" ) {
+        Hypercomplex<mpfr_t, dim> sqrt_h1 = sqrt(h1);
+        const double re = mpfr_get_d(sqrt_h1[0], MPFR_RNDN);
+        REQUIRE( re == Approx(1.313).epsilon(0.01) );
+        REQUIRE( close(sqrt_h1 * sqrt_h1, h1) );
+        Hypercomplex<mpfr_t, dim> sqrt_h2 = sqrt(h2);
+        REQUIRE( mpfr_zero_p(sqrt_h2[0]) );
+        REQUIRE( mpfr_cmp_si(sqrt_h2[1], 2) == 0 );
+        REQUIRE( mpfr_zero_p(sqrt_h2[2]) );
+    }
+
+    SECTION( "Real and hypercomplex powers" ) {
+        mpfr_set_si(p, 2, MPFR_RNDN);
+        REQUIRE( close(pow(h1, p), h1 * h1) );
+        mpfr_set_d(p, 0.5, MPFR_RNDN);
+        REQUIRE( close(pow(h1, p), sqrt(h1)) );
+        REQUIRE( close(pow(h2, p), sqrt(h2)) );
+        mpfr_set_zero(p, 0);
+        Hypercomplex<mpfr_t, dim> pow_h1 = pow(h1, p);
+        REQUIRE( mpfr_cmp_si(pow_h1[0], 1) == 0 );
+        REQUIRE( mpfr_zero_p(pow_h1[1]) );
+        mpfr_set_si(B[0], 2, MPFR_RNDN);
+        Hypercomplex<mpfr_t, dim> two(B);
+        REQUIRE( close(pow(h1, two), h1 * h1) );
+        REQUIRE( close(pow(h1, h1), exp(log(h1) * h1)) );
+        // integral exponents go through operator^
+        mpfr_set_si(p, -3, MPFR_RNDN);
+        REQUIRE( pow(h1, p) == (h1 ^ -3) );
+        mpfr_set_si(B[0], -2, MPFR_RNDN);
+        mpfr_set_zero(B[1], 0);
+        mpfr_set_si(p, 2, MPFR_RNDN);
+        Hypercomplex<mpfr_t, dim> minus_two(B);
+        pow_h1 = pow(minus_two, p);
+        REQUIRE( mpfr_cmp_si(pow_h1[0], 4) == 0 );
+        for (unsigned int i=1; i < dim; i++) REQUIRE( mpfr_zero_p(pow_h1[i]) );
+        // dimension 1: mpfr_pow
+        Hypercomplex<mpfr_t, 1> minus_two1(B);
+        REQUIRE( mpfr_cmp_si(pow(minus_two1, p)[0], 4) == 0 );
+        // zero to a negative power divides by zero
+        mpfr_set_zero(B[0], 0);
+        Hypercomplex<mpfr_t, dim> zero(B);
+        mpfr_set_si(p, -1, MPFR_RNDN);
+        REQUIRE_THROWS_AS(pow(zero, p), std::invalid_argument);
+        mpfr_set_d(p, -0.5, MPFR_RNDN);
+        REQUIRE_THROWS_AS(pow(zero, p), std::invalid_argument);
+    }
+
+    mpfr_clears(p, difference, static_cast<mpfr_ptr>(0));
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_clear(A[i]);
+        mpfr_clear(B[i]);
+    }
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: parallel batch operations", "[unit]" ) {
+    const unsigned int dim = 4;
+    const std::size_t n = 64;
+    set_mpfr_precision(200);
+    mpfr_t A[dim];
+    for (unsigned int i=0; i < dim; i++)
+        mpfr_init2(A[i], MPFR_global_precision);
+    std::vector<Hypercomplex<mpfr_t, dim>> H1, H2, out;
+    for (std::size_t j=0; j < n; j++) {
+        for (unsigned int i=0; i < dim; i++)
+            mpfr_set_si(A[i], (j * 7 + i * 3) % 11 - 5, MPFR_RNDN);
+        mpfr_set_si(A[0], j + 1, MPFR_RNDN);
+        H1.emplace_back(A);
+        for (unsigned int i=0; i < dim; i++)
+            mpfr_set_d(A[i], 0.001 * ((j * 5 + i) % 13), MPFR_RNDN);
+        H2.emplace_back(A);
+        out.emplace_back(A);
+    }
+    mpfr_t norm[n], norm_;
+    for (std::size_t j=0; j < n; j++) mpfr_init2(norm[j], MPFR_global_precision);
+    mpfr_init2(norm_, MPFR_global_precision);
+    const ParallelOptions options = {4, 3};
+    parallel_multiply(H1.data(), H2.data(), out.data(), n, options);
+    for (std::size_t j=0; j < n; j++) REQUIRE( out[j] == H1[j] * H2[j] );
+    parallel_divide(H2.data(), H1.data(), out.data(), n, options);
+    for (std::size_t j=0; j < n; j++) REQUIRE( out[j] == H2[j] / H1[j] );
+    parallel_exp(H2.data(), out.data(), n, options);
+    for (std::size_t j=0; j < n; j++) REQUIRE( out[j] == exp(H2[j]) );
+    parallel_norm(H1.data(), norm, n, options);
+    for (std::size_t j=0; j < n; j++) {
+        H1[j].norm(norm_);
+        REQUIRE( mpfr_equal_p(norm[j], norm_) );
+    }
+    for (std::size_t j=0; j < n; j++) mpfr_clear(norm[j]);
+    mpfr_clear(norm_);
+    for (unsigned int i=0; i < dim; i++) mpfr_clear(A[i]);
+    H1.clear();
+    H2.clear();
+    out.clear();
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: multiplication kernel", "[unit]" ) {
+    SECTION( "Rounding as in the scalar kernel" ) {
+        for (unsigned int seed=1; seed < 10; seed++) {
+            REQUIRE( mpfr_multiplication_matches_double<1>(seed) );
+            REQUIRE( mpfr_multiplication_matches_double<2>(seed) );
+            REQUIRE( mpfr_multiplication_matches_double<4>(seed) );
+            REQUIRE( mpfr_multiplication_matches_double<8>(seed) );
+            REQUIRE( mpfr_multiplication_matches_double<16>(seed) );
+            REQUIRE( mpfr_multiplication_matches_double<32>(seed) );
+            REQUIRE( mpfr_multiplication_matches_double<64>(seed) );
+        }
+    }
+
+    SECTION( "Operators" ) {
+        const unsigned int dim = 8;
+        set_mpfr_precision(300);
+        mpfr_t A[dim], B[dim], C[dim], workspace[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_init2(A[i], MPFR_global_precision);
+            mpfr_init2(B[i], MPFR_global_precision);
+            mpfr_init2(C[i], MPFR_global_precision);
+            mpfr_init2(workspace[i], MPFR_global_precision);
+            mpfr_set_si(A[i], 3 * i + 1, MPFR_RNDN);
+            mpfr_div_ui(A[i], A[i], 7, MPFR_RNDN);
+            mpfr_set_si(B[i], 5 - static_cast<int>(i), MPFR_RNDN);
+            mpfr_div_ui(B[i], B[i], 3, MPFR_RNDN);
+        }
+        Hypercomplex<mpfr_t, dim> h1(A);
+        Hypercomplex<mpfr_t, dim> h2(B);
+        cayley_dickson_multiply<dim>(A, B, C, workspace);
+        REQUIRE( h1 * h2 == Hypercomplex<mpfr_t, dim>(C) );
+        h1 *= h2;
+        REQUIRE( h1 == Hypercomplex<mpfr_t, dim>(C) );
+        cayley_dickson_multiply<dim>(C, C, A, workspace);
+        h1 *= h1;
+        REQUIRE( h1 == Hypercomplex<mpfr_t, dim>(A) );
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_clear(A[i]);
+            mpfr_clear(B[i]);
+            mpfr_clear(C[i]);
+            mpfr_clear(workspace[i]);
+        }
+    }
+
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: precision scopes", "[unit]" ) {
+    const unsigned int dim = 4;
+    set_mpfr_precision(200);
+    mpfr_t A[dim];
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_init2(A[i], 300);
+        mpfr_set_ui(A[i], i + 1, MPFR_RNDN);
+        mpfr_div_ui(A[i], A[i], 3, MPFR_RNDN);
+    }
+
+    SECTION( "Nesting" ) {
+        {
+            MPFRPrecisionScope scope(64);
+            REQUIRE( get_mpfr_precision() == 64 );
+            Hypercomplex<mpfr_t, dim> h(A);
+            REQUIRE( mpfr_get_prec(h[0]) == 64 );
+            {
+                MPFRPrecisionScope inner(1024);
+                Hypercomplex<mpfr_t, dim> h2 = h * h;
+                REQUIRE( mpfr_get_prec(h2[3]) == 1024 );
+                REQUIRE( mpfr_get_prec(exp(h)[1]) == 1024 );
+            }
+            REQUIRE( get_mpfr_precision() == 64 );
+            REQUIRE( mpfr_get_prec((~h)[2]) == 64 );
+        }
+        REQUIRE( get_mpfr_precision() == 200 );
+        Hypercomplex<mpfr_t, dim> h(A);
+        REQUIRE( mpfr_get_prec(h[0]) == 200 );
+    }
+
+    SECTION( "Assignments keep the precision of the target" ) {
+        Hypercomplex<mpfr_t, dim> x(A), y(A), z(A);
+        const Hypercomplex<mpfr_t, dim> y0(y), z0(z);
+        MPFRPrecisionScope scope(64);
+        const Hypercomplex<mpfr_t, dim> a(A);
+        x = a * a;  // move assignment of a 64-bit temporary
+        y *= a;
+        z /= a;
+        for (unsigned int i=0; i < dim; i++) {
+            REQUIRE( mpfr_get_prec(x[i]) == 200 );
+            REQUIRE( mpfr_get_prec(y[i]) == 200 );
+            REQUIRE( mpfr_get_prec(z[i]) == 200 );
+        }
+        REQUIRE( x == a * a );
+        REQUIRE( y == y0 * a );
+        REQUIRE( z == z0 / a );
+        Hypercomplex<mpfr_t, dim> w(A);
+        w = a * a;
+        REQUIRE( mpfr_get_prec(w[0]) == 64 );
+    }
+
+    SECTION( "Concurrent threads" ) {
+        const unsigned int precisions[] = {64, 128, 256, 1024};
+        bool correct[4] = {false, false, false, false};
+        std::vector<std::thread> threads;
+        for (unsigned int t=0; t < 4; t++) {
+            threads.emplace_back([&, t]() {
+                MPFRPrecisionScope scope(precisions[t]);
+                Hypercomplex<mpfr_t, dim> h(A);
+                for (unsigned int k=0; k < 50; k++) h = h * h / h;
+                correct[t] = get_mpfr_precision() == precisions[t];
+                for (unsigned int i=0; i < dim; i++) {
+                    if (mpfr_get_prec(h[i]) != precisions[t])
+                        correct[t] = false;
+                }
+            });
+        }
+        for (std::thread &thread : threads) thread.join();
+        for (unsigned int t=0; t < 4; t++) REQUIRE( correct[t] );
+        REQUIRE( get_mpfr_precision() == 200 );
+    }
+
+    SECTION( "Batch operations" ) {
+        MPFRPrecisionScope scope(96);
+        std::vector<Hypercomplex<mpfr_t, dim>> H, out;
+        for (unsigned int j=0; j < 16; j++) {
+            H.emplace_back(A);
+            out.emplace_back(A);
+        }
+        parallel_multiply(H.data(), H.data(), out.data(), 16, {4, 1});
+        for (unsigned int j=0; j < 16; j++) {
+            REQUIRE( mpfr_get_prec(out[j][0]) == 96 );
+            REQUIRE( out[j] == H[j] * H[j] );
+        }
+    }
+
+    for (unsigned int i=0; i < dim; i++) mpfr_clear(A[i]);
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: concurrent stress test", "[unit]" ) {
+    const unsigned int dim = 8;
+    const unsigned int precisions[] = {64, 113, 200, 512};
+    const unsigned int threads = std::max(std::thread::hardware_concurrency(), 4u);
+    set_mpfr_precision(128);
+    mpfr_t A[dim], B[dim];
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_init2(A[i], 600);
+        mpfr_init2(B[i], 600);
+        mpfr_set_si(A[i], static_cast<int>(i) - 3, MPFR_RNDN);
+        mpfr_div_ui(A[i], A[i], 7, MPFR_RNDN);
+        mpfr_set_ui(B[i], i + 1, MPFR_RNDN);
+        mpfr_div_ui(B[i], B[i], 11, MPFR_RNDN);
+    }
+    auto work = [&]() {
+        Hypercomplex<mpfr_t, dim> x(A);
+        Hypercomplex<mpfr_t, dim> y(B);
+        for (unsigned int k=0; k < 20; k++) x = exp(Im(x * y)) * (y ^ 2) / y;
+        return x;
+    };
+    std::vector<Hypercomplex<mpfr_t, dim>> reference;
+    for (const unsigned int precision : precisions) {
+        MPFRPrecisionScope scope(precision);
+        reference.push_back(work());
+        for (unsigned int i=0; i < dim; i++)
+            REQUIRE( mpfr_number_p(reference.back()[i]) );
+    }
+
+    SECTION( "Independent threads" ) {
+        std::vector<char> correct(threads, 0);
+        std::vector<std::thread> pool;
+        for (unsigned int t=0; t < threads; t++) {
+            pool.emplace_back([&, t]() {
+                {
+                    MPFRPrecisionScope scope(precisions[t % 4]);
+                    correct[t] = work() == reference[t % 4];
+                }
+                clear_mpfr_thread_memory();
+            });
+        }
+        for (std::thread &thread : pool) thread.join();
+        for (unsigned int t=0; t < threads; t++) REQUIRE( correct[t] );
+    }
+
+    SECTION( "Batch operations" ) {
+        MPFRPrecisionScope scope(precisions[3]);
+        const std::size_t n = 8 * threads;
+        std::vector<Hypercomplex<mpfr_t, dim>> H, out;
+        for (std::size_t j=0; j < n; j++) {
+            H.emplace_back(A);
+            out.emplace_back(A);
+            mpfr_set_ui(H[j][0], j, MPFR_RNDN);
+        }
+        const ParallelOptions options = {2 * threads, 1};
+        parallel_exp(H.data(), out.data(), n, options);
+        parallel_multiply(out.data(), H.data(), out.data(), n, options);
+        for (std::size_t j=0; j < n; j++) REQUIRE( out[j] == exp(H[j]) * H[j] );
+    }
+
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_clear(A[i]);
+        mpfr_clear(B[i]);
+    }
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: adaptive precision", "[unit]" ) {
+    set_mpfr_precision(64);
+
+    SECTION( "Correct rounding" ) {
+        for (unsigned int seed=1; seed < 6; seed++) {
+            for (const unsigned int precision : {24u, 53u, 113u, 300u}) {
+                REQUIRE( adaptive_matches_reference<1>(seed, precision) );
+                REQUIRE( adaptive_matches_reference<2>(seed, precision) );
+                REQUIRE( adaptive_matches_reference<4>(seed, precision) );
+                REQUIRE( adaptive_matches_reference<8>(seed, precision) );
+            }
+        }
+    }
+
+    SECTION( "Exact and cancelling components" ) {
+        const unsigned int dim = 4;
+        mpfr_t A[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_init2(A[i], 64);
+            mpfr_set_si(A[i], 2 * static_cast<int>(i) - 3, MPFR_RNDN);
+        }
+        Hypercomplex<mpfr_t, dim> h(A);
+        Hypercomplex<mpfr_t, dim> h2 = adaptive_multiply(h, ~h, 100);
+        REQUIRE( mpfr_cmp_ui(h2[0], 20) == 0 );
+        for (unsigned int i=1; i < dim; i++) REQUIRE( mpfr_zero_p(h2[i]) );
+        REQUIRE( adaptive_multiply(h, h, 100) == h * h );
+        REQUIRE( mpfr_cmp_ui(adaptive_divide(h, h, 100)[0], 1) == 0 );
+        for (unsigned int i=0; i < dim; i++) mpfr_clear(A[i]);
+    }
+
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: correctly rounded multiplication", "[unit]" ) {
+    set_mpfr_precision(64);
+    REQUIRE( !get_mpfr_rounded_multiplication() );
+
+    SECTION( "Correct rounding" ) {
+        for (unsigned int seed=1; seed < 6; seed++) {
+            for (const unsigned int precision : {24u, 53u, 113u, 300u}) {
+                REQUIRE( rounded_multiplication_matches_reference<1>(
+                    seed, precision) );
+                REQUIRE( rounded_multiplication_matches_reference<2>(
+                    seed, precision) );
+                REQUIRE( rounded_multiplication_matches_reference<8>(
+                    seed, precision) );
+                REQUIRE( rounded_multiplication_matches_reference<32>(
+                    seed, precision) );
+            }
+        }
+    }
+
+    SECTION( "Cancellation" ) {
+        // (a + i) * (c + i) with ac = 1 - 2^-120: the real part
+        // ac - 1 vanishes once the leaf ac is rounded to 64 bits
+        const unsigned int dim = 2;
+        mpfr_t A[dim], B[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_init2(A[i], 64);
+            mpfr_init2(B[i], 64);
+            mpfr_set_ui(A[i], 1, MPFR_RNDN);
+            mpfr_set_ui(B[i], 1, MPFR_RNDN);
+        }
+        mpfr_add_d(A[0], A[0], std::ldexp(1.0, -60), MPFR_RNDN);
+        mpfr_sub_d(B[0], B[0], std::ldexp(1.0, -60), MPFR_RNDN);
+        Hypercomplex<mpfr_t, dim> h1(A);
+        Hypercomplex<mpfr_t, dim> h2(B);
+        REQUIRE( mpfr_zero_p((h1 * h2)[0]) );
+        set_mpfr_rounded_multiplication(true);
+        Hypercomplex<mpfr_t, dim> h3 = h1 * h2;
+        set_mpfr_rounded_multiplication(false);
+        mpfr_set_si_2exp(A[0], -1, -120, MPFR_RNDN);
+        REQUIRE( mpfr_equal_p(h3[0], A[0]) );
+        mpfr_set_d(A[1], 2.0, MPFR_RNDN);
+        REQUIRE( mpfr_equal_p(h3[1], A[1]) );
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_clear(A[i]);
+            mpfr_clear(B[i]);
+        }
+    }
+
+    SECTION( "Mixed precisions" ) {
+        // the leaves are wide enough for the 64 x 300 bit products
+        const unsigned int dim = 4;
+        mpfr_t A[dim], B[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_init2(A[i], 300);
+            mpfr_init2(B[i], 64);
+            mpfr_set_si(A[i], 2 * static_cast<int>(i) - 3, MPFR_RNDN);
+            mpfr_div_ui(A[i], A[i], 3, MPFR_RNDN);
+        }
+        Hypercomplex<mpfr_t, dim> h1(A);
+        set_mpfr_precision(300);
+        Hypercomplex<mpfr_t, dim> h2(A);
+        set_mpfr_precision(64);
+        set_mpfr_rounded_multiplication(true);
+        Hypercomplex<mpfr_t, dim> h3 = h1 * h2;
+        Hypercomplex<mpfr_t, dim> h4 = h2 * h1;
+        Hypercomplex<mpfr_t, dim> h5(h1);
+        h5 *= h2;
+        set_mpfr_rounded_multiplication(false);
+        REQUIRE( mpfr_get_prec(h3[0]) == 64 );
+        REQUIRE( mpfr_get_prec(h4[0]) == 64 );
+        MPFRPrecisionScope reference(1000);
+        Hypercomplex<mpfr_t, dim> exact1 = h1 * h2;
+        Hypercomplex<mpfr_t, dim> exact2 = h2 * h1;
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_set(B[i], exact1[i], MPFR_RNDN);
+            REQUIRE( mpfr_equal_p(h3[i], B[i]) );
+            REQUIRE( mpfr_equal_p(h5[i], B[i]) );
+            mpfr_set(B[i], exact2[i], MPFR_RNDN);
+            REQUIRE( mpfr_equal_p(h4[i], B[i]) );
+        }
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_clear(A[i]);
+            mpfr_clear(B[i]);
+        }
+    }
+
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: reduced multiplication", "[unit]" ) {
+    const unsigned int precision = 4096;
+    REQUIRE( !is_mpfr_multiplication_reduced(
+        ReducedMultiplication<mpfr_t>::min_precision - 1) );
+    REQUIRE( is_mpfr_multiplication_reduced(precision) );
+    set_mpfr_rounded_multiplication(true);
+    REQUIRE( !is_mpfr_multiplication_reduced(precision) );
+    set_mpfr_rounded_multiplication(false);
+    set_mpfr_precision(precision);
+
+    SECTION( "Accuracy" ) {
+        // octonions with components in (-1, 1): errors below 2^(3 + 8)
+        // ulps of 1 against the correctly rounded product
+        const unsigned int dim = 8;
+        mpfr_t A[dim], B[dim], difference;
+        mpfr_init2(difference, precision);
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_init2(A[i], precision);
+            mpfr_init2(B[i], precision);
+            mpfr_set_si(A[i], 2 * i + 1, MPFR_RNDN);
+            mpfr_set_si(B[i], static_cast<int>(i) - 8, MPFR_RNDN);
+            mpfr_sqrt(A[i], A[i], MPFR_RNDN);
+            mpfr_div_ui(A[i], A[i], 5, MPFR_RNDN);
+            mpfr_div_ui(B[i], B[i], 11, MPFR_RNDN);
+        }
+        Hypercomplex<mpfr_t, dim> h1(A), h2(B);
+        Hypercomplex<mpfr_t, dim> reduced = h1 * h2;
+        set_mpfr_rounded_multiplication(true);
+        Hypercomplex<mpfr_t, dim> rounded = h1 * h2;
+        set_mpfr_rounded_multiplication(false);
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_sub(difference, reduced[i], rounded[i], MPFR_RNDN);
+            mpfr_abs(difference, difference, MPFR_RNDN);
+            REQUIRE( mpfr_cmp_si_2exp(difference, 1, 11 - precision) < 0 );
+        }
+        mpfr_clear(difference);
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_clear(A[i]);
+            mpfr_clear(B[i]);
+        }
+    }
+
+    SECTION( "Correct rounding of the adaptive operations" ) {
+        for (unsigned int seed=1; seed < 3; seed++) {
+            REQUIRE( adaptive_matches_reference<2>(seed, 2500) );
+            REQUIRE( adaptive_matches_reference<4>(seed, 2500) );
+            REQUIRE( adaptive_matches_reference<8>(seed, 2500) );
+        }
+    }
+
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: text output", "[unit]" ) {
+    set_mpfr_precision(64);
+    const unsigned int dim = 4;
+    mpfr_t A[dim];
+    for (unsigned int i=0; i < dim; i++) mpfr_init2(A[i], 64);
+    mpfr_set_d(A[0], 0.0, MPFR_RNDN);
+    mpfr_set_d(A[1], 3.25, MPFR_RNDN);
+    mpfr_set_d(A[2], -123456.0, MPFR_RNDN);
+    mpfr_set_d(A[3], 0.001, MPFR_RNDN);
+    Hypercomplex<mpfr_t, dim> h(A);
+
+    SECTION( "Print operator" ) {
+        // all 21 significant digits of 64 bits
+        std::ostringstream os;
+        os << h;
+        REQUIRE( os.str() ==
+            "000000000000000000000E0 325000000000000000000E1 "
+            "-123456000000000000000E6 100000000000000002082E-2" );
+    }
+
+    SECTION( "Digits and layouts" ) {
+        MPFRSerializer mantissa(5);
+        REQUIRE( mantissa.str(A[1]) == "32500E1" );
+        REQUIRE( mantissa.str(A[3]) == "10000E-2" );
+        MPFRSerializer scientific(5, MPFRSerializer::Format::scientific);
+        std::ostringstream os;
+        scientific.write(os, h);
+        REQUIRE( os.str() ==
+            "0.0000e+00 3.2500e+00 -1.2346e+05 1.0000e-03" );
+        MPFRSerializer one_digit(1, MPFRSerializer::Format::scientific);
+        REQUIRE( one_digit.str(A[2]) == "-1e+05" );
+        MPFRSerializer full(0, MPFRSerializer::Format::scientific);
+        REQUIRE( full.str(A[1]) == "3.25000000000000000000e+00" );
+        mpfr_t x;
+        mpfr_init2(x, 300);
+        mpfr_set_si_2exp(x, 1, 400, MPFR_RNDN);
+        REQUIRE( full.str(x).size() == 98 );
+        REQUIRE( full.str(x).substr(90) == "533e+120" );
+        mpfr_clear(x);
+    }
+
+    SECTION( "Special values" ) {
+        mpfr_t x;
+        mpfr_init2(x, 64);
+        MPFRSerializer mantissa(3);
+        MPFRSerializer scientific(3, MPFRSerializer::Format::scientific);
+        mpfr_set_nan(x);
+        REQUIRE( mantissa.str(x) == "@NaN@" );
+        REQUIRE( scientific.str(x) == "nan" );
+        mpfr_set_inf(x, -1);
+        REQUIRE( mantissa.str(x) == "-@Inf@" );
+        REQUIRE( scientific.str(x) == "-inf" );
+        mpfr_set_zero(x, -1);
+        REQUIRE( scientific.str(x) == "-0.00e+00" );
+        mpfr_clear(x);
+    }
+
+    SECTION( "Arrays" ) {
+        Hypercomplex<mpfr_t, dim> H[3] = {h, ~h, h * h};
+        MPFRSerializer serializer(4, MPFRSerializer::Format::scientific);
+        std::ostringstream os;
+        serializer.write(os, H, 3);
+        std::ostringstream expected;
+        for (unsigned int j=0; j < 3; j++) {
+            serializer.write(expected, H[j]);
+            expected << "\n";
+        }
+        REQUIRE( os.str() == expected.str() );
+        REQUIRE( os.str().substr(0, 41) ==
+            "0.000e+00 3.250e+00 -1.235e+05 1.000e-03\n" );
+    }
+
+    for (unsigned int i=0; i < dim; i++) mpfr_clear(A[i]);
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: binary checkpoints", "[unit]" ) {
+    set_mpfr_precision(300);
+    const unsigned int dim = 4;
+    mpfr_t A[dim];
+    for (unsigned int i=0; i < dim; i++) mpfr_init2(A[i], 300);
+    mpfr_const_pi(A[0], MPFR_RNDN);
+    mpfr_set_si(A[1], -7, MPFR_RNDN);
+    mpfr_set_si_2exp(A[2], 3, -100000, MPFR_RNDN);
+    mpfr_set_zero(A[3], -1);
+    Hypercomplex<mpfr_t, dim> h(A);
+    mpfr_set_nan(A[0]);
+    mpfr_set_inf(A[1], -1);
+    mpfr_set_inf(A[2], 1);
+    mpfr_set_zero(A[3], 1);
+    Hypercomplex<mpfr_t, dim> special(A);
+
+    // same value, sign and precision of every component
+    auto same = [](const mpfr_t x, const mpfr_t y) {
+        if (mpfr_get_prec(x) != mpfr_get_prec(y)) return false;
+        if (mpfr_nan_p(x) || mpfr_nan_p(y))
+            return mpfr_nan_p(x) && mpfr_nan_p(y);
+        return mpfr_equal_p(x, y) && mpfr_signbit(x) == mpfr_signbit(y);
+    };
+
+    SECTION( "Round trip" ) {
+        Hypercomplex<mpfr_t, dim> H[3] = {h, special, exp(h) / ~h};
+        std::stringstream ss;
+        MPFRCheckpoint::write(ss, H, 3);
+        MPFRCheckpoint::write(ss, h);
+        set_mpfr_precision(64);
+        std::vector<Hypercomplex<mpfr_t, dim>> restored =
+            MPFRCheckpoint::read<dim>(ss);
+        REQUIRE( restored.size() == 3 );
+        for (unsigned int j=0; j < 3; j++) {
+            for (unsigned int i=0; i < dim; i++)
+                REQUIRE( same(restored[j][i], H[j][i]) );
+        }
+        restored = MPFRCheckpoint::read<dim>(ss);
+        REQUIRE( restored.size() == 1 );
+        for (unsigned int i=0; i < dim; i++)
+            REQUIRE( same(restored[0][i], h[i]) );
+        REQUIRE( get_mpfr_precision() == 64 );
+    }
+
+    SECTION( "Mixed precisions" ) {
+        Hypercomplex<mpfr_t, dim> H(h);
+        mpfr_prec_round(H[1], 20, MPFR_RNDN);
+        std::stringstream ss;
+        MPFRCheckpoint::write(ss, H);
+        Hypercomplex<mpfr_t, dim> restored =
+            MPFRCheckpoint::read<dim>(ss).front();
+        for (unsigned int i=0; i < dim; i++) {
+            REQUIRE( mpfr_get_prec(restored[i]) == 300 );
+            REQUIRE( mpfr_equal_p(restored[i], H[i]) );
+        }
+        mpfr_prec_round(H[1], 300, MPFR_RNDN);
+    }
+
+    SECTION( "Invalid checkpoints" ) {
+        std::stringstream ss;
+        MPFRCheckpoint::write(ss, h);
+        const std::string checkpoint = ss.str();
+        std::stringstream other(checkpoint);
+        REQUIRE_THROWS_AS(
+            MPFRCheckpoint::read<2 * dim>(other), std::runtime_error);
+        std::stringstream truncated(
+            checkpoint.substr(0, checkpoint.size() - 1));
+        REQUIRE_THROWS_AS(
+            MPFRCheckpoint::read<dim>(truncated), std::runtime_error);
+        std::string corrupted = checkpoint;
+        corrupted[0] = 'X';
+        std::stringstream wrong_magic(corrupted);
+        REQUIRE_THROWS_AS(
+            MPFRCheckpoint::read<dim>(wrong_magic), std::runtime_error);
+        std::stringstream empty;
+        REQUIRE_THROWS_AS(
+            MPFRCheckpoint::read<dim>(empty), std::runtime_error);
+        // a corrupt precision must not allocate beyond the stream
+        corrupted = checkpoint;
+        const std::int64_t huge = MPFR_PREC_MAX;
+        std::memcpy(&corrupted[24], &huge, sizeof(huge));  // after the header
+        std::stringstream wrong_precision(corrupted);
+        REQUIRE_THROWS_AS(
+            MPFRCheckpoint::read<dim>(wrong_precision), std::runtime_error);
+    }
+
+    for (unsigned int i=0; i < dim; i++) mpfr_clear(A[i]);
+    clear_mpfr_memory();
+}
+
+TEST_CASE( "MPFR: pool of variables", "[unit]" ) {
+    set_mpfr_precision(200);
+    clear_mpfr_memory();
+
+    SECTION( "Reuse of released arrays" ) {
+        mpfr_t* block = MPFRPool::acquire(4);
+        MPFRPool::release(block, 4);
+        mpfr_t* reused = MPFRPool::acquire(4);
+        REQUIRE( reused == block );
+        REQUIRE( mpfr_get_prec(reused[3]) == 200 );
+        set_mpfr_precision(100);
+        mpfr_t* other = MPFRPool::acquire(4);
+        REQUIRE( other != reused );
+        REQUIRE( mpfr_get_prec(other[0]) == 100 );
+        MPFRPool::release(other, 4);
+        MPFRPool::release(reused, 4);
+        set_mpfr_precision(200);
+    }
+
+    SECTION( "Numbers and temporaries" ) {
+        const unsigned int dim = 4;
+        mpfr_t A[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_init2(A[i], MPFR_global_precision);
+            mpfr_set_si(A[i], i + 1, MPFR_RNDN);
+        }
+        Hypercomplex<mpfr_t, dim> h1(A);
+        Hypercomplex<mpfr_t, dim> h2(A);
+        mpfr_t* first;
+        {
+            Hypercomplex<mpfr_t, dim> h3 = h1 * h2 + ~h1;
+            first = &h3[0];
+        }
+        Hypercomplex<mpfr_t, dim> h4(A);
+        REQUIRE( &h4[0] == first );
+        for (unsigned int k=0; k < 100; k++) h4 = exp(h1) / h2 - h1.inv();
+        Hypercomplex<mpfr_t, dim> h5 = ~h1 - h1;
+        for (unsigned int i=0; i < dim; i++)
+            mpfr_set_si(A[i], -2 * static_cast<int>(i + 1), MPFR_RNDN);
+        mpfr_set_si(A[0], 0, MPFR_RNDN);
+        REQUIRE( h5 == Hypercomplex<mpfr_t, dim>(A) );
+        for (unsigned int i=0; i < dim; i++) mpfr_clear(A[i]);
+    }
+
+    SECTION( "Release on another thread" ) {
+        // the array joins the pool of the releasing thread
+        mpfr_t* block = MPFRPool::acquire(8);
+        bool reused = false, precision = false;
+        std::thread worker([&]() {
+            MPFRPool::release(block, 8);
+            mpfr_t* again = MPFRPool::acquire(8);
+            reused = again == block;
+            precision = mpfr_get_prec(again[7]) == get_mpfr_precision();
+            MPFRPool::release(again, 8);
+            clear_mpfr_thread_memory();
+        });
+        worker.join();
+        REQUIRE( reused );
+        REQUIRE( precision );
+    }
+
+    clear_mpfr_memory();
+}
+
 int main(int argc, char* const argv[]) {
     return Catch::Session().run(argc, argv);
 }
@@ -19,11 +19,153 @@
 #define HYPERCOMPLEX_HYPERCOMPLEX_HPP_
 
 #include <mpfr.h>
+#include <array>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <charconv>
+#include <climits>
 #include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__SSE2__) && !defined(HYPERCOMPLEX_NO_SIMD)
+#include <immintrin.h>
+#endif
+#if defined(__SIZEOF_FLOAT128__) && !defined(HYPERCOMPLEX_NO_QUADMATH)
+#if defined(__has_include)
+#if __has_include(<quadmath.h>)
+#include <quadmath.h>
+#define HYPERCOMPLEX_QUADMATH
+#endif
+#endif
+#endif
+
+/*
+###############################################################################
+#
+#   Elementary functions of the base types
+#
+###############################################################################
+*/
+
+// The templates of the main class call the elementary functions
+// unqualified, after using-declarations of this namespace, so that
+// overloads for other base types are still found by argument-dependent
+// lookup. Float and long double arguments resolve to their std
+// overloads (not to the double versions of the C library), and nothing
+// is added to the global namespace.
+namespace hypercomplex_math {
+
+using std::abs;
+using std::fabs;
+using std::signbit;
+using std::isnan;
+using std::ldexp;
+using std::sqrt;
+using std::exp;
+using std::log;
+using std::pow;
+using std::sin;
+using std::cos;
+using std::atan2;
+using std::operator<<;  // extended below for __float128
+
+#ifdef HYPERCOMPLEX_QUADMATH
+// Argument-dependent lookup does not apply to fundamental types,
+// so the libquadmath wrappers are declared ahead of the templates.
+// Programs using them link with -lquadmath.
+
+inline __float128 abs(const __float128 x) { return fabsq(x); }
+inline __float128 fabs(const __float128 x) { return fabsq(x); }
+inline bool signbit(const __float128 x) { return signbitq(x) != 0; }
+inline bool isnan(const __float128 x) { return isnanq(x) != 0; }
+inline __float128 ldexp(const __float128 x, const int n) {
+    return ldexpq(x, n);
+}
+inline __float128 sqrt(const __float128 x) { return sqrtq(x); }
+inline __float128 exp(const __float128 x) { return expq(x); }
+inline __float128 log(const __float128 x) { return logq(x); }
+inline __float128 pow(const __float128 x, const __float128 y) {
+    return powq(x, y);
+}
+inline __float128 sin(const __float128 x) { return sinq(x); }
+inline __float128 cos(const __float128 x) { return cosq(x); }
+inline void sin_cos(const __float128 x, __float128 &s, __float128 &c) {
+    sincosq(x, &s, &c);
+}
+inline __float128 real_pow(const __float128 x, const __float128 p) {
+    return powq(x, p);
+}
+inline __float128 atan2(const __float128 y, const __float128 x) {
+    return atan2q(y, x);
+}
+
+/** \brief Print a __float128 number
+  * \param [in,out] os output stream
+  * \param [in] x number to print
+  * \return output stream
+  *
+  * Formatted with quadmath_snprintf, following the floatfield flags
+  * and the precision of the stream. Brought into scope with
+  * using hypercomplex_math::operator<<.
+  */
+inline std::ostream& operator<<(std::ostream &os, const __float128 x) {
+    const std::ios_base::fmtflags field =
+        os.flags() & std::ios_base::floatfield;
+    const char *format = "%.*Qg";
+    if (field == std::ios_base::scientific) format = "%.*Qe";
+    if (field == std::ios_base::fixed) format = "%.*Qf";
+    const int precision = static_cast<int>(os.precision());
+    const int n = quadmath_snprintf(nullptr, 0, format, precision, x);
+    if (n < 0) {
+        os.setstate(std::ios_base::failbit);
+        return os;
+    }
+    std::string buffer(n, '\0');
+    quadmath_snprintf(&buffer[0], n + 1, format, precision, x);
+    return os << buffer;
+}
+#endif
+
+// Sine and cosine of the same argument. Compilers merge the two calls
+// for float, double and long double into one sincos() call; base types
+// with a joint algorithm overload this function.
+template <typename T>
+inline void sin_cos(const T &x, T &sin_x, T &cos_x) {
+    sin_x = sin(x);
+    cos_x = cos(x);
+}
+
+// Real power x^p of the base type: pow() for the standard types,
+// the logarithm for base types without a power function.
+template <typename T>
+inline T real_pow(const T &x, const T &p) {
+    if constexpr (std::is_floating_point<T>::value) {
+        return std::pow(x, p);
+    } else {
+        return exp(p * log(x));
+    }
+}
+
+}  // namespace hypercomplex_math
 
 /*
 ###############################################################################
@@ -33,12 +175,249 @@
 ###############################################################################
 */
 
+template <typename T, const unsigned int dim>
+class Hypercomplex;
+
+/** Base class of component-wise expressions on hypercomplex numbers
+  *
+  * Sums, differences, negations, conjugates and scalings are not
+  * evaluated on the spot. They build lightweight expression objects,
+  * which are evaluated in a single loop once assigned to a Hypercomplex.
+  * Named Hypercomplex operands are referred to, temporary ones are
+  * copied into the expression, so an expression stored in an auto
+  * variable must only not outlive the named numbers it refers to.
+  *
+  * Template parameters are:
+  * * type of the derived expression
+  * * base type of numbers
+  * * dimensionality of the algebra
+  */
+template <typename E, typename T, const unsigned int dim>
+class HypercomplexExpr {
+ public:
+    /** Base type of numbers */
+    using value_type = T;
+
+    /** \brief Access operator
+      * \param [in] i index for the element to evaluate
+      * \return i-th element of the expression
+      */
+    T operator[] (const unsigned int i) const {
+        return static_cast<const E&>(*this)[i];
+    }
+
+    /** \brief Dimensionality getter
+      * \return algebraic dimension of the underlying object
+      */
+    unsigned int _() const { return dim; }
+
+    /** \brief Calculate Euclidean norm of the expression
+      * \return calculated norm
+      */
+    T norm() const { return Hypercomplex<T, dim>(*this).norm(); }
+
+    /** \brief Calculate inverse of the expression
+      * \return new class instance
+      */
+    Hypercomplex<T, dim> inv() const {
+        return Hypercomplex<T, dim>(*this).inv();
+    }
+
+    /** \brief Cast the expression into a higher dimension
+      * \return new class instance
+      */
+    template <const unsigned int newdim>
+    Hypercomplex<T, newdim> expand() const {
+        return Hypercomplex<T, dim>(*this).template expand<newdim>();
+    }
+
+    /** \brief Addition-Assignment operator for a temporary expression
+      * \param [in] H existing class instance or expression
+      * \return new class instance
+      *
+      * The expression is evaluated into a new number first, so
+      * (H1 + H2) += H3 yields the same value as for a temporary number.
+      * The compound assignments are only available on temporaries.
+      */
+    template <typename E2>
+    Hypercomplex<T, dim> operator+= (
+        const HypercomplexExpr<E2, T, dim> &H
+    ) && {
+        Hypercomplex<T, dim> result(*this);
+        result += H;
+        return result;
+    }
+
+    /** \brief Subtraction-Assignment operator for a temporary expression
+      * \param [in] H existing class instance or expression
+      * \return new class instance
+      */
+    template <typename E2>
+    Hypercomplex<T, dim> operator-= (
+        const HypercomplexExpr<E2, T, dim> &H
+    ) && {
+        Hypercomplex<T, dim> result(*this);
+        result -= H;
+        return result;
+    }
+
+    /** \brief Multiplication-Assignment operator for a temporary expression
+      * \param [in] H existing class instance
+      * \return new class instance
+      */
+    Hypercomplex<T, dim> operator*= (const Hypercomplex<T, dim> &H) && {
+        Hypercomplex<T, dim> result(*this);
+        result *= H;
+        return result;
+    }
+
+    /** \brief Power-Assignment operator for a temporary expression
+      * \param [in] x integer power, negative powers raise the inverse
+      * \return new class instance
+      */
+    template <typename I>
+    Hypercomplex<T, dim> operator^= (const I x) && {
+        Hypercomplex<T, dim> result(*this);
+        result ^= x;
+        return result;
+    }
+
+    /** \brief Division-Assignment operator for a temporary expression
+      * \param [in] H existing class instance
+      * \return new class instance
+      */
+    Hypercomplex<T, dim> operator/= (const Hypercomplex<T, dim> &H) && {
+        Hypercomplex<T, dim> result(*this);
+        result /= H;
+        return result;
+    }
+};
+
+/** Operand held by an expression
+  *
+  * E is the operand type forwarded by the operator: Hypercomplex
+  * lvalues come as const references and are held by reference,
+  * nested expressions and temporary numbers are held by value.
+  */
+template <typename E>
+struct HypercomplexOperand {
+    using type = const E;
+};
+
+template <typename E>
+struct HypercomplexOperand<const E&> {
+    using type = const E&;
+};
+
+/** Forwarded type of an operand passed by const reference
+  *
+  * Hypercomplex numbers among them are lvalues (temporary numbers
+  * select the overloads taking Hypercomplex&&).
+  */
+template <typename E>
+struct HypercomplexLvalueOperand {
+    using type = E;
+};
+
+template <typename T, const unsigned int dim>
+struct HypercomplexLvalueOperand<Hypercomplex<T, dim>> {
+    using type = const Hypercomplex<T, dim>&;
+};
+
+template <typename E>
+using HypercomplexLvalue = typename HypercomplexLvalueOperand<E>::type;
+
+/** Restricts the overloads taking Hypercomplex&& to numbers which
+  * take part in expressions (not the MPFR specialisation).
+  */
+template <typename T, const unsigned int dim>
+using HypercomplexTemporary = std::enable_if_t<std::is_base_of<
+    HypercomplexExpr<Hypercomplex<T, dim>, T, dim>, Hypercomplex<T, dim>
+>::value>;
+
+/** Lazy sum of two expressions
+  */
+template <typename E1, typename E2, typename T, const unsigned int dim>
+class HypercomplexSum :
+    public HypercomplexExpr<HypercomplexSum<E1, E2, T, dim>, T, dim> {
+ private:
+    typename HypercomplexOperand<E1>::type e1;
+    typename HypercomplexOperand<E2>::type e2;
+
+ public:
+    HypercomplexSum(const E1 &H1, const E2 &H2) : e1(H1), e2(H2) {}
+    T operator[] (const unsigned int i) const { return e1[i] + e2[i]; }
+};
+
+/** Lazy difference of two expressions
+  */
+template <typename E1, typename E2, typename T, const unsigned int dim>
+class HypercomplexDifference :
+    public HypercomplexExpr<HypercomplexDifference<E1, E2, T, dim>, T, dim> {
+ private:
+    typename HypercomplexOperand<E1>::type e1;
+    typename HypercomplexOperand<E2>::type e2;
+
+ public:
+    HypercomplexDifference(const E1 &H1, const E2 &H2) : e1(H1), e2(H2) {}
+    T operator[] (const unsigned int i) const { return e1[i] - e2[i]; }
+};
+
+/** Lazy additive inverse of an expression
+  */
+template <typename E, typename T, const unsigned int dim>
+class HypercomplexNegation :
+    public HypercomplexExpr<HypercomplexNegation<E, T, dim>, T, dim> {
+ private:
+    typename HypercomplexOperand<E>::type e;
+
+ public:
+    explicit HypercomplexNegation(const E &H) : e(H) {}
+    T operator[] (const unsigned int i) const { return -e[i]; }
+};
+
+/** Lazy conjugate of an expression
+  */
+template <typename E, typename T, const unsigned int dim>
+class HypercomplexConjugate :
+    public HypercomplexExpr<HypercomplexConjugate<E, T, dim>, T, dim> {
+ private:
+    typename HypercomplexOperand<E>::type e;
+
+ public:
+    explicit HypercomplexConjugate(const E &H) : e(H) {}
+    T operator[] (const unsigned int i) const {
+        // load once, then pick the sign: GCC 12 at -O2 -mavx2 vectorises
+        // a choice between -e[i] and e[i] wrongly for class types
+        const T x = e[i];
+        return i ? -x : x;
+    }
+};
+
+/** Lazy product of an expression and a scalar
+  */
+template <typename E, typename T, const unsigned int dim>
+class HypercomplexScaling :
+    public HypercomplexExpr<HypercomplexScaling<E, T, dim>, T, dim> {
+ private:
+    typename HypercomplexOperand<E>::type e;
+    const T x;
+
+ public:
+    HypercomplexScaling(const E &H, const T &x) : e(H), x(x) {}
+    T operator[] (const unsigned int i) const { return x * e[i]; }
+};
+
 /** Main class of the library
+  *
+  * Components are stored inline, so for arithmetic base types
+  * the objects are trivially copyable and never touch the heap.
   */
 template <typename T, const unsigned int dim>
-class Hypercomplex {
+class Hypercomplex :
+    public HypercomplexExpr<Hypercomplex<T, dim>, T, dim> {
  private:
-    T* arr;
+    std::array<T, dim> arr;
 
  public:
     /** \brief This is the main constructor
@@ -59,11 +438,26 @@ class Hypercomplex {
       * * base type of numbers in the argument array
       * * dimensionality of the algebra
       */
-    Hypercomplex(const Hypercomplex &H);
+    Hypercomplex(const Hypercomplex &H) = default;
+
+    /** \brief This is the move constructor
+      * \param [in] H existing class instance
+      * \return new class instance
+      */
+    Hypercomplex(Hypercomplex &&H) = default;
+
+    /** \brief Evaluate an expression into a new number
+      * \param [in] H expression on hypercomplex numbers
+      * \return new class instance
+      * 
+      * All components are computed in a single pass.
+      */
+    template <typename E>
+    Hypercomplex(const HypercomplexExpr<E, T, dim> &H);  // NOLINT
 
     Hypercomplex() = delete;
 
-    ~Hypercomplex();
+    ~Hypercomplex() = default;
 
     /** \brief Dimensionality getter
       * \return algebraic dimension of the underlying object
@@ -95,21 +489,26 @@ class Hypercomplex {
     template <const unsigned int newdim>
     Hypercomplex<T, newdim> expand() const;
 
-    /** \brief Create a complex conjugate
-      * \return new class instance
+    /** \brief Assignment operator
+      * \param [in] H existing class instance
+      * \return Reference to the caller (for chained assignments)
       */
-    Hypercomplex operator~ () const;
+    Hypercomplex& operator= (const Hypercomplex &H) = default;
 
-    /** \brief Create an additive inverse of a given number
-      * \return new class instance
+    /** \brief Move-Assignment operator
+      * \param [in] H existing class instance
+      * \return Reference to the caller (for chained assignments)
       */
-    Hypercomplex operator- () const;
+    Hypercomplex& operator= (Hypercomplex &&H) = default;
 
-    /** \brief Assignment operator
-      * \param [in] H existing class instance
+    /** \brief Assignment operator for expressions
+      * \param [in] H expression on hypercomplex numbers
       * \return Reference to the caller (for chained assignments)
+      * 
+      * All components are computed in a single pass.
       */
-    Hypercomplex& operator= (const Hypercomplex &H);
+    template <typename E>
+    Hypercomplex& operator= (const HypercomplexExpr<E, T, dim> &H);
 
     /** \brief Access operator
       * \param [in] i index for the element to access
@@ -118,19 +517,27 @@ class Hypercomplex {
       * Note that the return type is the same as
       * template parameter.
       */
-    T& operator[] (const unsigned int i) const;
+    T& operator[] (const unsigned int i);
+
+    /** \brief Access operator (const objects)
+      * \param [in] i index for the element to access
+      * \return i-th element of the number
+      */
+    const T& operator[] (const unsigned int i) const;
 
     /** \brief Addition-Assignment operator
-      * \param [in] H existing class instance
+      * \param [in] H existing class instance or expression
       * \return Reference to the caller
       */
-    Hypercomplex& operator+= (const Hypercomplex &H);
+    template <typename E>
+    Hypercomplex& operator+= (const HypercomplexExpr<E, T, dim> &H);
 
     /** \brief Subtraction-Assignment operator
-      * \param [in] H existing class instance
+      * \param [in] H existing class instance or expression
       * \return Reference to the caller
       */
-    Hypercomplex& operator-= (const Hypercomplex &H);
+    template <typename E>
+    Hypercomplex& operator-= (const HypercomplexExpr<E, T, dim> &H);
 
     /** \brief Multiplication-Assignment operator
       * \param [in] H existing class instance
@@ -139,10 +546,11 @@ class Hypercomplex {
     Hypercomplex& operator*= (const Hypercomplex &H);
 
     /** \brief Power-Assignment operator
-      * \param [in] x power
+      * \param [in] x integer power, negative powers raise the inverse
       * \return Reference to the caller
       */
-    Hypercomplex& operator^= (const unsigned int x);
+    template <typename I>
+    Hypercomplex& operator^= (const I x);
 
     /** \brief Division-Assignment operator
       * \param [in] H existing class instance
@@ -151,15 +559,53 @@ class Hypercomplex {
     Hypercomplex& operator/= (const Hypercomplex &H);
 };
 
+/** \brief Create a complex conjugate
+  * \param [in] H existing expression
+  * \return lazy expression
+  */
+template <typename E, typename T, const unsigned int dim>
+HypercomplexConjugate<HypercomplexLvalue<E>, T, dim> operator~ (
+    const HypercomplexExpr<E, T, dim> &H
+);
+
+/** \brief Create a complex conjugate of a temporary number
+  * \param [in] H temporary number, held by value
+  * \return lazy expression
+  */
+template <typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexConjugate<Hypercomplex<T, dim>, T, dim> operator~ (
+    Hypercomplex<T, dim> &&H
+);
+
+/** \brief Create an additive inverse of a given number
+  * \param [in] H existing expression
+  * \return lazy expression
+  */
+template <typename E, typename T, const unsigned int dim>
+HypercomplexNegation<HypercomplexLvalue<E>, T, dim> operator- (
+    const HypercomplexExpr<E, T, dim> &H
+);
+
+/** \brief Create an additive inverse of a temporary number
+  * \param [in] H temporary number, held by value
+  * \return lazy expression
+  */
+template <typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexNegation<Hypercomplex<T, dim>, T, dim> operator- (
+    Hypercomplex<T, dim> &&H
+);
+
 /** \brief Equality operator
   * \param [in] H1 LHS operand
   * \param [in] H2 RHS operand
   * \return boolean value after the comparison
   */
-template <typename T, const unsigned int dim>
+template <typename E1, typename E2, typename T, const unsigned int dim>
 bool operator== (
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 );
 
 /** \brief Inequality operator
@@ -167,32 +613,166 @@ bool operator== (
   * \param [in] H2 RHS operand
   * \return boolean value after the comparison
   */
-template <typename T, const unsigned int dim>
+template <typename E1, typename E2, typename T, const unsigned int dim>
 bool operator!= (
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 );
 
 /** \brief Addition operator
   * \param [in] H1 LHS operand
   * \param [in] H2 RHS operand
-  * \return new class instance
+  * \return lazy expression
   */
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> operator+ (
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+template <typename E1, typename E2, typename T, const unsigned int dim>
+HypercomplexSum<
+    HypercomplexLvalue<E1>, HypercomplexLvalue<E2>, T, dim
+> operator+ (
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+);
+
+/** \brief Addition operator for a temporary LHS operand
+  * \param [in] H1 LHS operand, held by value
+  * \param [in] H2 RHS operand
+  * \return lazy expression
+  */
+template <typename E2, typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexSum<
+    Hypercomplex<T, dim>, HypercomplexLvalue<E2>, T, dim
+> operator+ (
+    Hypercomplex<T, dim> &&H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+);
+
+/** \brief Addition operator for a temporary RHS operand
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand, held by value
+  * \return lazy expression
+  */
+template <typename E1, typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexSum<
+    HypercomplexLvalue<E1>, Hypercomplex<T, dim>, T, dim
+> operator+ (
+    const HypercomplexExpr<E1, T, dim> &H1,
+    Hypercomplex<T, dim> &&H2
+);
+
+/** \brief Addition operator for two temporary operands
+  * \param [in] H1 LHS operand, held by value
+  * \param [in] H2 RHS operand, held by value
+  * \return lazy expression
+  */
+template <typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexSum<
+    Hypercomplex<T, dim>, Hypercomplex<T, dim>, T, dim
+> operator+ (
+    Hypercomplex<T, dim> &&H1,
+    Hypercomplex<T, dim> &&H2
 );
 
 /** \brief Subtraction operator
   * \param [in] H1 LHS operand
   * \param [in] H2 RHS operand
-  * \return new class instance
+  * \return lazy expression
   */
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> operator- (
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+template <typename E1, typename E2, typename T, const unsigned int dim>
+HypercomplexDifference<
+    HypercomplexLvalue<E1>, HypercomplexLvalue<E2>, T, dim
+> operator- (
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+);
+
+/** \brief Subtraction operator for a temporary LHS operand
+  * \param [in] H1 LHS operand, held by value
+  * \param [in] H2 RHS operand
+  * \return lazy expression
+  */
+template <typename E2, typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexDifference<
+    Hypercomplex<T, dim>, HypercomplexLvalue<E2>, T, dim
+> operator- (
+    Hypercomplex<T, dim> &&H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+);
+
+/** \brief Subtraction operator for a temporary RHS operand
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand, held by value
+  * \return lazy expression
+  */
+template <typename E1, typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexDifference<
+    HypercomplexLvalue<E1>, Hypercomplex<T, dim>, T, dim
+> operator- (
+    const HypercomplexExpr<E1, T, dim> &H1,
+    Hypercomplex<T, dim> &&H2
+);
+
+/** \brief Subtraction operator for two temporary operands
+  * \param [in] H1 LHS operand, held by value
+  * \param [in] H2 RHS operand, held by value
+  * \return lazy expression
+  */
+template <typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexDifference<
+    Hypercomplex<T, dim>, Hypercomplex<T, dim>, T, dim
+> operator- (
+    Hypercomplex<T, dim> &&H1,
+    Hypercomplex<T, dim> &&H2
+);
+
+/** \brief Scalar multiplication operator
+  * \param [in] x LHS scalar operand
+  * \param [in] H RHS operand
+  * \return lazy expression
+  */
+template <typename E, typename T, const unsigned int dim>
+HypercomplexScaling<HypercomplexLvalue<E>, T, dim> operator* (
+    const typename HypercomplexExpr<E, T, dim>::value_type &x,
+    const HypercomplexExpr<E, T, dim> &H
+);
+
+/** \brief Scalar multiplication operator for a temporary number
+  * \param [in] x LHS scalar operand
+  * \param [in] H RHS operand, held by value
+  * \return lazy expression
+  */
+template <typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexScaling<Hypercomplex<T, dim>, T, dim> operator* (
+    const typename Hypercomplex<T, dim>::value_type &x,
+    Hypercomplex<T, dim> &&H
+);
+
+/** \brief Scalar multiplication operator
+  * \param [in] H LHS operand
+  * \param [in] x RHS scalar operand
+  * \return lazy expression
+  */
+template <typename E, typename T, const unsigned int dim>
+HypercomplexScaling<HypercomplexLvalue<E>, T, dim> operator* (
+    const HypercomplexExpr<E, T, dim> &H,
+    const typename HypercomplexExpr<E, T, dim>::value_type &x
+);
+
+/** \brief Scalar multiplication operator for a temporary number
+  * \param [in] H LHS operand, held by value
+  * \param [in] x RHS scalar operand
+  * \return lazy expression
+  */
+template <typename T, const unsigned int dim,
+    typename = HypercomplexTemporary<T, dim>>
+HypercomplexScaling<Hypercomplex<T, dim>, T, dim> operator* (
+    Hypercomplex<T, dim> &&H,
+    const typename Hypercomplex<T, dim>::value_type &x
 );
 
 /** \brief Multiplication operator
@@ -206,15 +786,40 @@ Hypercomplex<T, dim> operator* (
     const Hypercomplex<T, dim> &H2
 );
 
+/** \brief Multiplication operator for expressions
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand
+  * \return new class instance
+  */
+template <typename E1, typename E2, typename T, const unsigned int dim>
+Hypercomplex<T, dim> operator* (
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+);
+
 /** \brief Power operator
   * \param [in] H LHS operand
-  * \param [in] x RHS operand
+  * \param [in] x RHS operand: integer power
   * \return new class instance
+  * 
+  * Computed by repeated squaring in O(log|x|) multiplications.
+  * Zero power yields the identity, negative powers raise the inverse.
   */
-template <typename T, const unsigned int dim>
+template <typename T, const unsigned int dim, typename I>
 Hypercomplex<T, dim> operator^ (
     const Hypercomplex<T, dim> &H,
-    const unsigned int x
+    const I x
+);
+
+/** \brief Power operator for expressions
+  * \param [in] H LHS operand
+  * \param [in] x RHS operand: integer power
+  * \return new class instance
+  */
+template <typename E, typename T, const unsigned int dim, typename I>
+Hypercomplex<T, dim> operator^ (
+    const HypercomplexExpr<E, T, dim> &H,
+    const I x
 );
 
 /** \brief Division operator
@@ -228,91 +833,527 @@ Hypercomplex<T, dim> operator/ (
     const Hypercomplex<T, dim> &H2
 );
 
+/** \brief Division operator for expressions
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand
+  * \return new class instance
+  */
+template <typename E1, typename E2, typename T, const unsigned int dim>
+Hypercomplex<T, dim> operator/ (
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+);
+
 /** \brief Print operator
   * \param [in,out] os output stream
-  * \param [in] H existing class instance
+  * \param [in] H existing expression
   * \return output stream
   */
-template <typename T, const unsigned int dim>
-std::ostream& operator<< (std::ostream &os, const Hypercomplex<T, dim> &H);
+template <typename E, typename T, const unsigned int dim>
+std::ostream& operator<< (
+    std::ostream &os,
+    const HypercomplexExpr<E, T, dim> &H
+);
 
 /** \brief Real part of a hypercomplex number
-  * \param [in] H existing class instance
+  * \param [in] H existing expression
   * \return new class instance
   */
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> Re(const Hypercomplex<T, dim> &H);
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> Re(const HypercomplexExpr<E, T, dim> &H);
 
 /** \brief Imaginary part of a hypercomplex number
-  * \param [in] H existing class instance
+  * \param [in] H existing expression
   * \return new class instance
   */
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> Im(const Hypercomplex<T, dim> &H);
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> Im(const HypercomplexExpr<E, T, dim> &H);
 
 /** \brief Exponentiation operation on a hypercomplex number
-  * \param [in] H existing class instance
+  * \param [in] H existing expression
   * \return new class instance
   */
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> exp(const Hypercomplex<T, dim> &H);
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> exp(const HypercomplexExpr<E, T, dim> &H);
 
-/*
-###############################################################################
-#
-#   Implementation section
-#
-###############################################################################
-*/
+/** \brief Natural logarithm of a hypercomplex number
+  * \param [in] H existing expression
+  * \return new class instance
+  *
+  * log(H) = log|H| + u arg(H) with u = Im(H) / |Im(H)| and
+  * arg(H) = atan2(|Im(H)|, Re(H)) in [0, pi]. Real numbers take u
+  * along the first imaginary unit, except in dimension 1 where the
+  * logarithm of the base type applies (NaN for negative numbers).
+  */
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> log(const HypercomplexExpr<E, T, dim> &H);
 
-// Hypercomplex main constructor
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>::Hypercomplex(const T* ARR) {
-    if (dim == 0) throw std::invalid_argument("invalid dimension");
-    if ((dim & (dim - 1)) != 0) {
+/** \brief Square root of a hypercomplex number
+  * \param [in] H existing expression
+  * \return new class instance
+  *
+  * The root with a non-negative real part, along the imaginary unit
+  * u of log(). Evaluated as sqrt((|H| + |Re(H)|) / 2), which does not
+  * cancel, and one division.
+  */
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> sqrt(const HypercomplexExpr<E, T, dim> &H);
+
+/** \brief Real power of a hypercomplex number
+  * \param [in] H existing expression
+  * \param [in] p real exponent
+  * \return new class instance
+  *
+  * H^p = |H|^p (cos(p arg(H)) + u sin(p arg(H))) = exp(p log(H)) with
+  * u and arg(H) as in log(); H^0 = 1 for all H. Integral exponents
+  * with |p| < 2^31 go through repeated multiplication with operator^,
+  * so that e.g. (-2)^2 is exactly 4. In dimension 1 the power of
+  * the base type applies to other exponents (NaN for negative numbers).
+  * Throws std::invalid_argument for a zero number and p < 0.
+  */
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> pow(
+    const HypercomplexExpr<E, T, dim> &H,
+    const typename HypercomplexExpr<E, T, dim>::value_type &p
+);
+
+/** \brief Hypercomplex power of a hypercomplex number
+  * \param [in] H1 base
+  * \param [in] H2 exponent
+  * \return new class instance
+  *
+  * H1^H2 = exp(log(H1) H2), with the logarithm on the left as the
+  * multiplication does not commute beyond dimension 2.
+  */
+template <typename E1, typename E2, typename T, const unsigned int dim>
+Hypercomplex<T, dim> pow(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+);
+
+/** Container of hypercomplex numbers in a structure-of-arrays layout
+  *
+  * Each component of all the numbers is stored in its own contiguous
+  * lane aligned to a cache line, so bulk operations run over plain
+  * arrays that the compiler can vectorise. Elements are accessed as
+  * Hypercomplex objects through get() and set().
+  *
+  * Template parameters are:
+  * * base type of numbers
+  * * dimensionality of the algebra
+  */
+template <typename T, const unsigned int dim>
+class HypercomplexArray {
+ private:
+    static_assert(
+        std::is_trivially_copyable<T>::value,
+        "HypercomplexArray requires a trivially copyable base type"
+    );
+    static constexpr std::size_t alignment = 64;
+    std::size_t n;
+    std::size_t stride;
+    T* data;
+    void allocate(const std::size_t size);
+    void release();
+
+ public:
+    /** Number of elements processed at once by the bulk operations */
+    static constexpr std::size_t block = 256;
+
+    /** \brief This is the main constructor
+      * \param [in] size number of elements, all initialised to zero
+      */
+    explicit HypercomplexArray(const std::size_t size);
+
+    /** \brief This is the copy constructor
+      * \param [in] A existing class instance
+      */
+    HypercomplexArray(const HypercomplexArray &A);
+
+    /** \brief This is the move constructor
+      * \param [in] A temporary class instance, left empty
+      */
+    HypercomplexArray(HypercomplexArray &&A) noexcept;
+
+    HypercomplexArray() = delete;
+
+    ~HypercomplexArray();
+
+    /** \brief Assignment operator
+      * \param [in] A existing class instance
+      * \return Reference to the caller (for chained assignments)
+      */
+    HypercomplexArray& operator= (const HypercomplexArray &A);
+
+    /** \brief Move-Assignment operator
+      * \param [in] A temporary class instance
+      * \return Reference to the caller (for chained assignments)
+      */
+    HypercomplexArray& operator= (HypercomplexArray &&A) noexcept;
+
+    /** \brief Size getter
+      * \return number of elements
+      */
+    std::size_t size() const { return n; }
+
+    /** \brief Dimensionality getter
+      * \return dim
+      */
+    unsigned int _() const { return dim; }
+
+    /** \brief Access a component lane
+      * \param [in] i index of the component
+      * \return pointer to the i-th components of all elements
+      */
+    T* lane(const unsigned int i);
+
+    /** \brief Access a component lane (const objects)
+      * \param [in] i index of the component
+      * \return pointer to the i-th components of all elements
+      */
+    const T* lane(const unsigned int i) const;
+
+    /** \brief Element getter
+      * \param [in] j index of the element
+      * \return j-th element as a new Hypercomplex instance
+      */
+    Hypercomplex<T, dim> get(const std::size_t j) const;
+
+    /** \brief Element setter
+      * \param [in] j index of the element
+      * \param [in] H new value of the element
+      */
+    void set(const std::size_t j, const Hypercomplex<T, dim> &H);
+
+    /** \brief Calculate Euclidean norms of all elements
+      * \return vector of calculated norms
+      */
+    std::vector<T> norm() const;
+
+    /** \brief Calculate inverses of all elements
+      * \return new class instance
+      */
+    HypercomplexArray inv() const;
+};
+
+/** \brief Element-wise complex conjugate
+  * \param [in] A existing class instance
+  * \return new class instance
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator~ (const HypercomplexArray<T, dim> &A);
+
+/** \brief Element-wise addition operator
+  * \param [in] A1 LHS operand
+  * \param [in] A2 RHS operand
+  * \return new class instance
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator+ (
+    const HypercomplexArray<T, dim> &A1,
+    const HypercomplexArray<T, dim> &A2
+);
+
+/** \brief Element-wise subtraction operator
+  * \param [in] A1 LHS operand
+  * \param [in] A2 RHS operand
+  * \return new class instance
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator- (
+    const HypercomplexArray<T, dim> &A1,
+    const HypercomplexArray<T, dim> &A2
+);
+
+/** \brief Element-wise multiplication operator
+  * \param [in] A1 LHS operand
+  * \param [in] A2 RHS operand
+  * \return new class instance
+  *
+  * Products follow the recursive definition bit for bit,
+  * like the scalar multiplication kernel, as long as the compiler
+  * does not contract floating-point expressions (-ffp-contract=off).
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator* (
+    const HypercomplexArray<T, dim> &A1,
+    const HypercomplexArray<T, dim> &A2
+);
+
+/** \brief Element-wise exponentiation
+  * \param [in] A existing class instance
+  * \return new class instance
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> exp(const HypercomplexArray<T, dim> &A);
+
+/** Settings of the multi-threaded batch operations
+  */
+struct ParallelOptions {
+    /** Number of threads (including the caller), 0 uses all cores */
+    unsigned int threads = 0;
+    /** Number of elements a thread claims at once, 0 picks a default */
+    std::size_t grain = 0;
+};
+
+/** Per-thread setup and cleanup of the worker threads
+  *
+  * The state captured on the calling thread is handed to every
+  * worker thread at the start of each batch operation, and
+  * worker_exit() is called when a worker thread ends. Specialised for base
+  * types that keep thread-local state; if concurrent() is false
+  * the batch operations run on the calling thread only.
+  */
+template <typename T>
+struct ParallelContext {
+    struct State {};
+    static bool concurrent() { return true; }
+    static State capture() { return State(); }
+    static void worker_enter(const State &) {}
+    static void worker_exit() {}
+};
+
+/** \brief Run a function over chunks of a range on several threads
+  * \param [in] n size of the range [0, n)
+  * \param [in] options number of threads and chunk size
+  * \param [in] body function called as body(begin, end) for every chunk
+  *
+  * Threads claim the next chunk from a shared counter as soon as they
+  * are done with the previous one, so uneven costs are balanced.
+  * The worker threads are started on first use and reused by later
+  * calls.
+  * The first exception thrown by the body is rethrown to the caller.
+  */
+template <typename T, typename F>
+void parallel_for(
+    const std::size_t n,
+    const ParallelOptions &options,
+    const F &body
+);
+
+/** \brief Multi-threaded element-wise multiplication
+  * \param [in] H1 array of LHS operands
+  * \param [in] H2 array of RHS operands
+  * \param [out] out array of results (may alias the operands)
+  * \param [in] n number of elements
+  * \param [in] options number of threads and chunk size
+  */
+template <typename T, const unsigned int dim>
+void parallel_multiply(
+    const Hypercomplex<T, dim> *H1,
+    const Hypercomplex<T, dim> *H2,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n,
+    const ParallelOptions &options = ParallelOptions()
+);
+
+/** \brief Multi-threaded element-wise division
+  * \param [in] H1 array of LHS operands
+  * \param [in] H2 array of RHS operands
+  * \param [out] out array of results (may alias the operands)
+  * \param [in] n number of elements
+  * \param [in] options number of threads and chunk size
+  */
+template <typename T, const unsigned int dim>
+void parallel_divide(
+    const Hypercomplex<T, dim> *H1,
+    const Hypercomplex<T, dim> *H2,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n,
+    const ParallelOptions &options = ParallelOptions()
+);
+
+/** \brief Multi-threaded element-wise exponentiation
+  * \param [in] H array of operands
+  * \param [out] out array of results (may alias the operands)
+  * \param [in] n number of elements
+  * \param [in] options number of threads and chunk size
+  */
+template <typename T, const unsigned int dim>
+void parallel_exp(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n,
+    const ParallelOptions &options = ParallelOptions()
+);
+
+/** \brief Multi-threaded element-wise Euclidean norm
+  * \param [in] H array of operands
+  * \param [out] out array of norms
+  * \param [in] n number of elements
+  * \param [in] options number of threads and chunk size
+  */
+template <typename T, const unsigned int dim>
+void parallel_norm(
+    const Hypercomplex<T, dim> *H,
+    T *out,
+    const std::size_t n,
+    const ParallelOptions &options = ParallelOptions()
+);
+
+/** \brief Vectorised element-wise exponentiation
+  * \param [in] H array of operands
+  * \param [out] out array of results (may alias the operands)
+  * \param [in] n number of elements
+  *
+  * For float and double numbers. Blocks of numbers are transposed into
+  * component lanes and evaluated with the branch-free functions of
+  * VectorMath, which the compiler vectorises. Components are within
+  * 4 max(1, |Im(H)|) ulp of the norm of the exact result, as those
+  * of exp(), but the last bits may differ. HypercomplexArray
+  * operands skip the transposition and are the fastest.
+  */
+template <typename T, const unsigned int dim>
+void batch_exp(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+);
+
+/** \brief Vectorised element-wise natural logarithm
+  * \param [in] H array of operands
+  * \param [out] out array of results (may alias the operands)
+  * \param [in] n number of elements
+  *
+  * log(H) = log|H| + u arg(H) with u = Im(H) / |Im(H)|, or the first
+  * imaginary unit for real H, and arg(H) in [0, pi]; NaN for negative
+  * H of dimension 1. For float and double numbers; components are
+  * within 4 ulp of max(1, |log(H)|).
+  */
+template <typename T, const unsigned int dim>
+void batch_log(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+);
+
+/** \brief Vectorised element-wise square root
+  * \param [in] H array of operands
+  * \param [out] out array of results (may alias the operands)
+  * \param [in] n number of elements
+  *
+  * Root with a non-negative real part, along the first imaginary unit
+  * for negative real H; NaN for negative H of dimension 1. For float
+  * and double numbers; components are within 4 ulp of the norm of
+  * the exact result.
+  */
+template <typename T, const unsigned int dim>
+void batch_sqrt(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+);
+
+/** \brief Vectorised element-wise real power
+  * \param [in] H array of operands
+  * \param [in] p real exponent
+  * \param [out] out array of results (may alias the operands)
+  * \param [in] n number of elements
+  *
+  * H^p = exp(p log(H)) with the logarithm of batch_log(), H^0 = 1
+  * for all H. For float and double numbers; components are within
+  * 4 (1 + |p log|H|| + |p arg(H)|) ulp of the norm of the exact
+  * result. Throws std::invalid_argument if p < 0 and an element is
+  * zero, before any result is written.
+  */
+template <typename T, const unsigned int dim>
+void batch_pow(
+    const Hypercomplex<T, dim> *H,
+    const T p,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+);
+
+/** \brief Vectorised element-wise exponentiation
+  * \param [in] A existing class instance
+  * \return new class instance
+  *
+  * As batch_exp() of an array of numbers, without the transposition.
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_exp(const HypercomplexArray<T, dim> &A);
+
+/** \brief Vectorised element-wise natural logarithm
+  * \param [in] A existing class instance
+  * \return new class instance
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_log(const HypercomplexArray<T, dim> &A);
+
+/** \brief Vectorised element-wise square root
+  * \param [in] A existing class instance
+  * \return new class instance
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_sqrt(const HypercomplexArray<T, dim> &A);
+
+/** \brief Vectorised element-wise real power
+  * \param [in] A existing class instance
+  * \param [in] p real exponent
+  * \return new class instance
+  *
+  * Throws std::invalid_argument if p < 0 and an element is zero.
+  */
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_pow(
+    const HypercomplexArray<T, dim> &A,
+    const T p
+);
+
+/*
+###############################################################################
+#
+#   Implementation section
+#
+###############################################################################
+*/
+
+// Hypercomplex main constructor
+template <typename T, const unsigned int dim>
+Hypercomplex<T, dim>::Hypercomplex(const T* ARR) {
+    if (dim == 0) throw std::invalid_argument("invalid dimension");
+    if ((dim & (dim - 1)) != 0) {
         throw std::invalid_argument("invalid dimension");
     }
-    arr = new T[dim];
     for (unsigned int i=0; i < dim; i++) arr[i] = ARR[i];
 }
 
-// Hypercomplex copy constructor
+// Hypercomplex constructor from an expression
 template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>::Hypercomplex(const Hypercomplex<T, dim> &H) {
-    arr = new T[dim];
+template <typename E>
+Hypercomplex<T, dim>::Hypercomplex(const HypercomplexExpr<E, T, dim> &H) {
     for (unsigned int i=0; i < dim; i++) arr[i] = H[i];
 }
 
-// Hypercomplex destructor
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>::~Hypercomplex() {
-    delete[] arr;
-}
-
 // calculate norm of the number
 template <typename T, const unsigned int dim>
 inline T Hypercomplex<T, dim>::norm() const {
+    using hypercomplex_math::sqrt;
     T result = T();
     for (unsigned int i=0; i < dim; i++) result = result + arr[i] * arr[i];
     return sqrt(result);
 }
 
+// conjugate of a divisor and its squared norm, summed without a square
+// root: H^-1 = ~H / |H|^2 and H1 / H2 = (H1 ~H2) / |H2|^2
+template <typename T, const unsigned int dim>
+T divisor_conjugate(const T *H, T *conj) {
+    T norm2 = T();
+    for (unsigned int i=0; i < dim; i++) norm2 = norm2 + H[i] * H[i];
+    if (norm2 == T()) throw std::invalid_argument("division by zero");
+    conj[0] = H[0];
+    for (unsigned int i=1; i < dim; i++) conj[i] = -H[i];
+    return norm2;
+}
+
 // calculate inverse of the number
 template <typename T, const unsigned int dim>
 Hypercomplex<T, dim> Hypercomplex<T, dim>::inv() const {
-    T zero = T();
-    T norm = (*this).norm();
-    if (norm == zero) {
-        throw std::invalid_argument("division by zero");
-    } else {
-        T* temparr = new T[dim];
-        temparr[0] = arr[0] / (norm * norm);
-        for (unsigned int i=1; i < dim; i++)
-            temparr[i] = -arr[i] / (norm * norm);
-        Hypercomplex<T, dim> H(temparr);
-        delete[] temparr;
-        return H;
-    }
+    T temparr[dim];
+    const T norm2 = divisor_conjugate<T, dim>(arr.data(), temparr);
+    for (unsigned int i=0; i < dim; i++) temparr[i] = temparr[i] / norm2;
+    Hypercomplex<T, dim> H(temparr);
+    return H;
 }
 
 // cast object to a higher dimension
@@ -320,59 +1361,79 @@ template <typename T, const unsigned int dim>
 template <const unsigned int newdim>
 Hypercomplex<T, newdim> Hypercomplex<T, dim>::expand() const {
     if (newdim <= dim) throw std::invalid_argument("invalid dimension");
-    T* temparr = new T[newdim]();  // zero-init
+    T temparr[newdim] = {};  // zero-init
     for (unsigned int i=0; i < dim; i++) temparr[i] = arr[i];
     Hypercomplex<T, newdim> H(temparr);
-    delete[] temparr;
     return H;
 }
 
 // overloaded ~ operator
-template <typename T, const unsigned int dim>
-inline Hypercomplex<T, dim> Hypercomplex<T, dim>::operator~() const {
-    T* temparr = new T[dim];
-    temparr[0] = arr[0];
-    for (unsigned int i=1; i < dim; i++) temparr[i] = -arr[i];
-    Hypercomplex<T, dim> H(temparr);
-    delete[] temparr;
-    return H;
+template <typename E, typename T, const unsigned int dim>
+inline HypercomplexConjugate<HypercomplexLvalue<E>, T, dim> operator~(
+    const HypercomplexExpr<E, T, dim> &H
+) {
+    return HypercomplexConjugate<HypercomplexLvalue<E>, T, dim>(
+        static_cast<const E&>(H)
+    );
+}
+
+// overloaded ~ operator for a temporary number
+template <typename T, const unsigned int dim, typename>
+inline HypercomplexConjugate<Hypercomplex<T, dim>, T, dim> operator~(
+    Hypercomplex<T, dim> &&H
+) {
+    return HypercomplexConjugate<Hypercomplex<T, dim>, T, dim>(H);
 }
 
 // overloaded - unary operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> Hypercomplex<T, dim>::operator-() const {
-    T* temparr = new T[dim];
-    for (unsigned int i=0; i < dim; i++) temparr[i] = -arr[i];
-    Hypercomplex<T, dim> H(temparr);
-    delete[] temparr;
-    return H;
+template <typename E, typename T, const unsigned int dim>
+inline HypercomplexNegation<HypercomplexLvalue<E>, T, dim> operator-(
+    const HypercomplexExpr<E, T, dim> &H
+) {
+    return HypercomplexNegation<HypercomplexLvalue<E>, T, dim>(
+        static_cast<const E&>(H)
+    );
 }
 
-// overloaded = operator
+// overloaded - unary operator for a temporary number
+template <typename T, const unsigned int dim, typename>
+inline HypercomplexNegation<Hypercomplex<T, dim>, T, dim> operator-(
+    Hypercomplex<T, dim> &&H
+) {
+    return HypercomplexNegation<Hypercomplex<T, dim>, T, dim>(H);
+}
+
+// overloaded = operator for expressions
 template <typename T, const unsigned int dim>
+template <typename E>
 inline Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator=(
-    const Hypercomplex &H
+    const HypercomplexExpr<E, T, dim> &H
 ) {
-    // self-assignment guard
-    if (this == &H) return *this;
-    // reassign
+    // every component only depends on the same components of the
+    // operands, so evaluating in place is safe even if they alias
     for (unsigned int i=0; i < dim; i++) arr[i] = H[i];
-    // return the existing object so we can chain this operator
     return *this;
 }
 
 // overloaded [] operator
 template <typename T, const unsigned int dim>
-inline T& Hypercomplex<T, dim>::operator[](const unsigned int i) const {
+inline T& Hypercomplex<T, dim>::operator[](const unsigned int i) {
     assert(0 <= i && i < dim);
     return arr[i];
 }
 
-// overloaded == operator
+// overloaded [] operator for const objects
 template <typename T, const unsigned int dim>
+inline const T& Hypercomplex<T, dim>::operator[](const unsigned int i) const {
+    assert(0 <= i && i < dim);
+    return arr[i];
+}
+
+// overloaded == operator
+template <typename E1, typename E2, typename T, const unsigned int dim>
 bool operator==(
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 ) {
     for (unsigned int i=0; i < dim; i++) {
         if (H1[i] != H2[i]) return false;
@@ -381,199 +1442,3102 @@ bool operator==(
 }
 
 // overloaded != operator
-template <typename T, const unsigned int dim>
+template <typename E1, typename E2, typename T, const unsigned int dim>
 bool operator!=(
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 ) {
     return !(H1 == H2);
 }
 
 // overloaded + binary operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> operator+(
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+template <typename E1, typename E2, typename T, const unsigned int dim>
+inline HypercomplexSum<
+    HypercomplexLvalue<E1>, HypercomplexLvalue<E2>, T, dim
+> operator+(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 ) {
-    T *temparr = new T[dim];
-    for (unsigned int i=0; i < dim; i++) temparr[i] = H1[i] + H2[i];
-    Hypercomplex<T, dim> H(temparr);
-    delete[] temparr;
-    return H;
+    return HypercomplexSum<
+        HypercomplexLvalue<E1>, HypercomplexLvalue<E2>, T, dim
+    >(static_cast<const E1&>(H1), static_cast<const E2&>(H2));
 }
 
-// overloaded - binary operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> operator-(
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+// overloaded + binary operator for a temporary LHS operand
+template <typename E2, typename T, const unsigned int dim, typename>
+inline HypercomplexSum<
+    Hypercomplex<T, dim>, HypercomplexLvalue<E2>, T, dim
+> operator+(
+    Hypercomplex<T, dim> &&H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 ) {
-    T* temparr = new T[dim];
-    for (unsigned int i=0; i < dim; i++) temparr[i] = H1[i] - H2[i];
-    Hypercomplex<T, dim> H(temparr);
-    delete[] temparr;
-    return H;
+    return HypercomplexSum<
+        Hypercomplex<T, dim>, HypercomplexLvalue<E2>, T, dim
+    >(H1, static_cast<const E2&>(H2));
 }
 
-// overloaded * binary operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> operator*(
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+// overloaded + binary operator for a temporary RHS operand
+template <typename E1, typename T, const unsigned int dim, typename>
+inline HypercomplexSum<
+    HypercomplexLvalue<E1>, Hypercomplex<T, dim>, T, dim
+> operator+(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    Hypercomplex<T, dim> &&H2
 ) {
-    // recursion base:
-    if constexpr (dim == 1) {
-        T temparr[] = { H1[0] * H2[0] };
-        Hypercomplex<T, 1> H_(temparr);
-        return H_;
-    // recursion step:
-    } else {
-        // shared objects:
-        const unsigned int halfd = dim / 2;
-        T* temparr = new T[dim];
-        // construct helper objects:
-        for (unsigned int i=0; i < halfd; i++) temparr[i] = H1[i];
-        Hypercomplex<T, halfd> H1a(temparr);
-        for (unsigned int i=0; i < halfd; i++) temparr[i] = H1[i+halfd];
-        Hypercomplex<T, halfd> H1b(temparr);
-        for (unsigned int i=0; i < halfd; i++) temparr[i] = H2[i];
-        Hypercomplex<T, halfd> H2a(temparr);
-        for (unsigned int i=0; i < halfd; i++) temparr[i] = H2[i+halfd];
-        Hypercomplex<T, halfd> H2b(temparr);
-        // multiply recursively:
-        Hypercomplex<T, halfd> H1a2a = H1a * H2a;
-        Hypercomplex<T, halfd> H2b_1b = ~H2b * H1b;
-        Hypercomplex<T, halfd> H2b1a = H2b * H1a;
-        Hypercomplex<T, halfd> H1b2a_ = H1b * ~H2a;
-        // construct the final object
-        Hypercomplex<T, halfd> Ha = H1a2a - H2b_1b;
-        Hypercomplex<T, halfd> Hb = H2b1a + H1b2a_;
-        for (unsigned int i=0; i < halfd; i++) temparr[i] = Ha[i];
-        for (unsigned int i=0; i < halfd; i++) temparr[i+halfd] = Hb[i];
-        Hypercomplex<T, dim> H(temparr);
-        delete[] temparr;
-        return H;
-    }
+    return HypercomplexSum<
+        HypercomplexLvalue<E1>, Hypercomplex<T, dim>, T, dim
+    >(static_cast<const E1&>(H1), H2);
 }
 
-// overloaded ^ binary operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> operator^(
-    const Hypercomplex<T, dim> &H,
-    const unsigned int x
+// overloaded + binary operator for two temporary operands
+template <typename T, const unsigned int dim, typename>
+inline HypercomplexSum<
+    Hypercomplex<T, dim>, Hypercomplex<T, dim>, T, dim
+> operator+(
+    Hypercomplex<T, dim> &&H1,
+    Hypercomplex<T, dim> &&H2
 ) {
-    if (!(x)) {
-        throw std::invalid_argument("zero is not a valid argument");
-    } else {
-        Hypercomplex<T, dim> Hx(H);
-        for (unsigned int i=0; i < x-1; i++) Hx = Hx * H;
-        return Hx;
-    }
+    return HypercomplexSum<
+        Hypercomplex<T, dim>, Hypercomplex<T, dim>, T, dim
+    >(H1, H2);
 }
 
-// overloaded / binary operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> operator/(
-    const Hypercomplex<T, dim> &H1,
-    const Hypercomplex<T, dim> &H2
+// overloaded - binary operator
+template <typename E1, typename E2, typename T, const unsigned int dim>
+inline HypercomplexDifference<
+    HypercomplexLvalue<E1>, HypercomplexLvalue<E2>, T, dim
+> operator-(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 ) {
-    // division H1 / H2 is implemented as H1 * 1/H2
-    Hypercomplex<T, dim> H = H1 * H2.inv();
-    return(H);
+    return HypercomplexDifference<
+        HypercomplexLvalue<E1>, HypercomplexLvalue<E2>, T, dim
+    >(static_cast<const E1&>(H1), static_cast<const E2&>(H2));
 }
 
-// overloaded += operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator+=(
-    const Hypercomplex<T, dim> &H
+// overloaded - binary operator for a temporary LHS operand
+template <typename E2, typename T, const unsigned int dim, typename>
+inline HypercomplexDifference<
+    Hypercomplex<T, dim>, HypercomplexLvalue<E2>, T, dim
+> operator-(
+    Hypercomplex<T, dim> &&H1,
+    const HypercomplexExpr<E2, T, dim> &H2
 ) {
-    Hypercomplex<T, dim> result = (*this) + H;
-    for (unsigned int i=0; i < dim; i++) (*this)[i] = result[i];
-    return *this;
+    return HypercomplexDifference<
+        Hypercomplex<T, dim>, HypercomplexLvalue<E2>, T, dim
+    >(H1, static_cast<const E2&>(H2));
 }
 
-// overloaded -= operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator-=(
-    const Hypercomplex<T, dim> &H
+// overloaded - binary operator for a temporary RHS operand
+template <typename E1, typename T, const unsigned int dim, typename>
+inline HypercomplexDifference<
+    HypercomplexLvalue<E1>, Hypercomplex<T, dim>, T, dim
+> operator-(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    Hypercomplex<T, dim> &&H2
 ) {
-    Hypercomplex<T, dim> result = (*this) - H;
-    for (unsigned int i=0; i < dim; i++) (*this)[i] = result[i];
-    return *this;
+    return HypercomplexDifference<
+        HypercomplexLvalue<E1>, Hypercomplex<T, dim>, T, dim
+    >(static_cast<const E1&>(H1), H2);
 }
 
-// overloaded *= operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator*=(
-    const Hypercomplex<T, dim> &H
+// overloaded - binary operator for two temporary operands
+template <typename T, const unsigned int dim, typename>
+inline HypercomplexDifference<
+    Hypercomplex<T, dim>, Hypercomplex<T, dim>, T, dim
+> operator-(
+    Hypercomplex<T, dim> &&H1,
+    Hypercomplex<T, dim> &&H2
 ) {
-    Hypercomplex<T, dim> result = (*this) * H;
-    for (unsigned int i=0; i < dim; i++) (*this)[i] = result[i];
-    return *this;
+    return HypercomplexDifference<
+        Hypercomplex<T, dim>, Hypercomplex<T, dim>, T, dim
+    >(H1, H2);
 }
 
-// overloaded ^= operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator^=(
-    const unsigned int x
+// overloaded * operator for a scalar LHS operand
+template <typename E, typename T, const unsigned int dim>
+inline HypercomplexScaling<HypercomplexLvalue<E>, T, dim> operator*(
+    const typename HypercomplexExpr<E, T, dim>::value_type &x,
+    const HypercomplexExpr<E, T, dim> &H
 ) {
-    Hypercomplex<T, dim> result = (*this) ^ x;
-    for (unsigned int i=0; i < dim; i++) (*this)[i] = result[i];
-    return *this;
+    return HypercomplexScaling<HypercomplexLvalue<E>, T, dim>(
+        static_cast<const E&>(H), x
+    );
 }
 
-// overloaded /= operator
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator/=(
-    const Hypercomplex<T, dim> &H
+// overloaded * operator for a scalar LHS operand and a temporary number
+template <typename T, const unsigned int dim, typename>
+inline HypercomplexScaling<Hypercomplex<T, dim>, T, dim> operator*(
+    const typename Hypercomplex<T, dim>::value_type &x,
+    Hypercomplex<T, dim> &&H
 ) {
-    Hypercomplex<T, dim> result = (*this) / H;
-    for (unsigned int i=0; i < dim; i++) (*this)[i] = result[i];
-    return *this;
+    return HypercomplexScaling<Hypercomplex<T, dim>, T, dim>(H, x);
 }
 
-// overload << operator
-template <typename T, const unsigned int dim>
-std::ostream& operator<< (std::ostream &os, const Hypercomplex<T, dim> &H) {
-    for (unsigned int i=0; i < dim - 1; i++) os << H[i] << " ";
-    os << H[dim - 1];
-    return os;
+// overloaded * operator for a scalar RHS operand
+template <typename E, typename T, const unsigned int dim>
+inline HypercomplexScaling<HypercomplexLvalue<E>, T, dim> operator*(
+    const HypercomplexExpr<E, T, dim> &H,
+    const typename HypercomplexExpr<E, T, dim>::value_type &x
+) {
+    return HypercomplexScaling<HypercomplexLvalue<E>, T, dim>(
+        static_cast<const E&>(H), x
+    );
 }
 
-// return the real part of the number
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> Re(const Hypercomplex<T, dim> &H) {
-    Hypercomplex<T, dim> result = H;
-    for (unsigned int i=1; i < dim; i++) result[i] = T();
-    return result;
+// overloaded * operator for a temporary number and a scalar RHS operand
+template <typename T, const unsigned int dim, typename>
+inline HypercomplexScaling<Hypercomplex<T, dim>, T, dim> operator*(
+    Hypercomplex<T, dim> &&H,
+    const typename Hypercomplex<T, dim>::value_type &x
+) {
+    return HypercomplexScaling<Hypercomplex<T, dim>, T, dim>(H, x);
 }
 
-// return the imaginary part of the number
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> Im(const Hypercomplex<T, dim> &H) {
-    Hypercomplex<T, dim> result = H;
+/** Compile-time table of the Cayley-Dickson basis products
+  *
+  * Every component of a product is a signed sum of dim products of
+  * the operands' components, one per leaf of the recursive definition
+  * (a,b)(c,d) = (ac - conj(d)b, da + b conj(c)).
+  * Leaf p of the k-th component multiplies H1[lhs[k][p]] by
+  * H2[rhs[k][p]] and is negated if neg[k][p] is set.
+  */
+template <const unsigned int dim>
+struct CayleyDicksonTable {
+    unsigned int lhs[dim][dim];
+    unsigned int rhs[dim][dim];
+    bool neg[dim][dim];
+};
+
+/** \brief Number of levels of the Cayley-Dickson recursion
+  * \param [in] dim dimensionality of the algebra
+  * \return binary logarithm of dim
+  */
+constexpr unsigned int cayley_dickson_levels(const unsigned int dim) {
+    unsigned int levels = 0;
+    while ((1u << levels) < dim) levels++;
+    return levels;
+}
+
+/** \brief Generate the table of the Cayley-Dickson basis products
+  * \return table for the algebra of a given dimension
+  *
+  * Follows every leaf of the recursion down from the top level,
+  * tracking which slice of which operand is multiplied at each step
+  * and whether that slice has been negated or conjugated on the way.
+  * Consecutive leaves share the path down to the level at which
+  * their indices differ, so only the rest of it is recomputed;
+  * this keeps the compile-time cost at O(dim^2).
+  */
+template <const unsigned int dim>
+constexpr CayleyDicksonTable<dim> cayley_dickson_table() {
+    // slice of an operand: src[off+i] with sign flips
+    struct Slice {
+        bool lhs;
+        unsigned int off;
+        bool neg;  // all elements negated
+        bool conj;  // all but the first element negated
+    };
+    constexpr unsigned int levels = cayley_dickson_levels(dim);
+    CayleyDicksonTable<dim> table = {};
+    // path[l]: operand slices and component index at level l
+    Slice X[levels + 1] = {}, Y[levels + 1] = {};
+    unsigned int c[levels + 1] = {};
+    for (unsigned int k=0; k < dim; k++) {
+        X[0] = {true, 0, false, false};
+        Y[0] = {false, 0, false, false};
+        c[0] = k;
+        for (unsigned int p=0; p < dim; p++) {
+            // first level at which leaf p leaves the path of leaf p-1
+            unsigned int l = 0;
+            if (p > 0) {
+                unsigned int carry = p;
+                l = levels - 1;
+                while ((carry & 1) == 0) {
+                    carry >>= 1;
+                    l--;
+                }
+            }
+            for (; l < levels; l++) {
+                const unsigned int h = dim >> (l + 1);
+                const Slice Xa = X[l], Ya = Y[l];
+                const Slice Xb = {
+                    Xa.lhs, Xa.off + h, Xa.neg != Xa.conj, false
+                };
+                const Slice Yb = {
+                    Ya.lhs, Ya.off + h, Ya.neg != Ya.conj, false
+                };
+                Slice L1 = Xa, L2 = Ya, R1 = Yb, R2 = Xb;  // ac - conj(d)b
+                R1.conj = !R1.conj;
+                c[l + 1] = c[l];
+                if (c[l] >= h) {  // da + b conj(c)
+                    L1 = Yb; L2 = Xa; R1 = Xb; R2 = Ya;
+                    R2.conj = !R2.conj;
+                    c[l + 1] -= h;
+                }
+                if ((p & h) == 0) {
+                    X[l + 1] = L1; Y[l + 1] = L2;
+                } else {
+                    X[l + 1] = R1; Y[l + 1] = R2;
+                }
+            }
+            const Slice &XL = X[levels], &YL = Y[levels];
+            table.lhs[k][p] = XL.lhs ? XL.off : YL.off;
+            table.rhs[k][p] = XL.lhs ? YL.off : XL.off;
+            table.neg[k][p] = XL.neg != YL.neg;
+        }
+    }
+    return table;
+}
+
+// multiply two arrays of components, the output must not alias the input
+template <typename T, const unsigned int dim>
+inline void cayley_dickson_multiply(const T *H1, const T *H2, T *out) {
+    static constexpr CayleyDicksonTable<dim> table =
+        cayley_dickson_table<dim>();
+    T leaves[dim];
+    for (unsigned int k=0; k < dim; k++) {
+        for (unsigned int p=0; p < dim; p++) {
+            T x = H1[table.lhs[k][p]] * H2[table.rhs[k][p]];
+            leaves[p] = table.neg[k][p] ? -x : x;
+        }
+        // pairwise reduction in the order of the recursive definition:
+        // halves of size m/2 are subtracted in the first half of
+        // a level-m result and added in the second one
+        for (unsigned int m=2; m <= dim; m *= 2) {
+            for (unsigned int q=0; q < dim / m; q++) {
+                if (k & (m / 2))
+                    leaves[q] = leaves[2*q] + leaves[2*q+1];
+                else
+                    leaves[q] = leaves[2*q] - leaves[2*q+1];
+            }
+        }
+        out[k] = leaves[0];
+    }
+}
+
+/** Choice of the product algorithm for a base type
+  *
+  * The default kernels perform dim^2 multiplications of the base type.
+  * Specialise this trait as std::true_type for base types whose
+  * multiplication is much more expensive than addition (before their
+  * first product) to select cayley_dickson_reduced_multiply() instead:
+  * \code{.cpp}
+  *   template <> struct ReducedMultiplication<BigFloat> : std::true_type {};
+  * \endcode
+  */
+template <typename T>
+struct ReducedMultiplication : std::false_type {};
+
+/** \brief Multiply two arrays of components with fewer multiplications
+  * \param [in] H1 LHS operand, dim components
+  * \param [in] H2 RHS operand, dim components
+  * \param [out] out product, must not alias the operands
+  *
+  * Complex numbers take 3 multiplications (Gauss), quaternions 8
+  * (Howell and Lafon); larger algebras are split into their
+  * Cayley-Dickson halves, (a,b)(c,d) = (ac - conj(d)b, da + b conj(c)),
+  * down to quaternions: dim^2 / 2 multiplications in total.
+  * The price is about three times as many additions and errors
+  * bounded relative to the norms of the operands rather than to
+  * the terms of each component.
+  */
+template <typename T, const unsigned int dim>
+void cayley_dickson_reduced_multiply(const T *H1, const T *H2, T *out) {
+    if constexpr (dim == 1) {
+        out[0] = H1[0] * H2[0];
+    } else if constexpr (dim == 2) {
+        const T k1 = H2[0] * (H1[0] + H1[1]);
+        const T k2 = H1[0] * (H2[1] - H2[0]);
+        const T k3 = H1[1] * (H2[0] + H2[1]);
+        out[0] = k1 - k3;
+        out[1] = k1 + k2;
+    } else if constexpr (dim == 4) {
+        const T &a1 = H1[0], &b1 = H1[1], &c1 = H1[2], &d1 = H1[3];
+        const T &a2 = H2[0], &b2 = H2[1], &c2 = H2[2], &d2 = H2[3];
+        const T t0 = (d1 - c1) * (c2 - d2);
+        const T t1 = (a1 + b1) * (a2 + b2);
+        const T t2 = (a1 - b1) * (c2 + d2);
+        const T t3 = (c1 + d1) * (a2 - b2);
+        const T t4 = (d1 - b1) * (b2 - c2);
+        const T t5 = (d1 + b1) * (b2 + c2);
+        const T t6 = (a1 + c1) * (a2 - d2);
+        const T t7 = (a1 - c1) * (a2 + d2);
+        const T t8 = t5 + t6 + t7;
+        const T t9 = (t4 + t8) * static_cast<T>(0.5);
+        out[0] = t0 + t9 - t5;
+        out[1] = t1 + t9 - t8;
+        out[2] = t2 + t9 - t7;
+        out[3] = t3 + t9 - t6;
+    } else {
+        constexpr unsigned int h = dim / 2;
+        const T *a = H1, *b = H1 + h, *c = H2, *d = H2 + h;
+        T conj_c[h], conj_d[h], p1[h], p2[h], p3[h], p4[h];  // NOLINT
+        conj_c[0] = c[0];
+        conj_d[0] = d[0];
+        for (unsigned int i=1; i < h; i++) {
+            conj_c[i] = -c[i];
+            conj_d[i] = -d[i];
+        }
+        cayley_dickson_reduced_multiply<T, h>(a, c, p1);
+        cayley_dickson_reduced_multiply<T, h>(conj_d, b, p2);
+        cayley_dickson_reduced_multiply<T, h>(d, a, p3);
+        cayley_dickson_reduced_multiply<T, h>(b, conj_c, p4);
+        for (unsigned int i=0; i < h; i++) {
+            out[i] = p1[i] - p2[i];
+            out[h + i] = p3[i] + p4[i];
+        }
+    }
+}
+
+/** Multiplication kernel used by the main class
+  *
+  * Defaults to the scalar table-driven kernel, which reproduces
+  * the recursive definition bit for bit, or to the reduced one
+  * for base types marked by ReducedMultiplication. Vectorised
+  * kernels are selected for some base types and dimensions below.
+  * Exact agreement requires that the compiler does not fuse
+  * multiplications and additions (-ffp-contract=off), which GCC
+  * does by default on targets with FMA instructions.
+  * HypercomplexArray products follow the kernel in use: the pairwise
+  * reduction of the table, or the sequential sum of the vectorised
+  * kernels if sequential is true.
+  */
+template <typename T, const unsigned int dim>
+struct HypercomplexKernel {
+    static constexpr bool sequential = false;
+    static void multiply(const T *H1, const T *H2, T *out) {
+        if constexpr (ReducedMultiplication<T>::value)
+            cayley_dickson_reduced_multiply<T, dim>(H1, H2, out);
+        else
+            cayley_dickson_multiply<T, dim>(H1, H2, out);
+    }
+};
+
+#if defined(__SSE2__) && !defined(HYPERCOMPLEX_NO_SIMD)
+
+/** Sign masks of the Cayley-Dickson product in broadcast form
+  *
+  * The k-th component of a product is the sum over i of
+  * H1[i] * H2[i ^ k] with a sign given by the table of basis products.
+  * m[i][k] is -0 if that term is negated and +0 otherwise,
+  * so the signs can be applied by xor-ing the sign bits.
+  */
+template <typename T, const unsigned int dim>
+struct CayleyDicksonMasks {
+    T m[dim][dim];
+};
+
+/** \brief Generate the sign masks of the Cayley-Dickson product
+  * \return masks for the algebra of a given dimension
+  */
+template <typename T, const unsigned int dim>
+constexpr CayleyDicksonMasks<T, dim> cayley_dickson_masks() {
+    constexpr CayleyDicksonTable<dim> table = cayley_dickson_table<dim>();
+    CayleyDicksonMasks<T, dim> masks = {};
+    for (unsigned int k=0; k < dim; k++) {
+        for (unsigned int p=0; p < dim; p++) {
+            // leaf p is subtracted at every level of the pairwise
+            // reduction where it is the right operand of a difference
+            bool neg = table.neg[k][p];
+            for (unsigned int bits = p & ~k; bits; bits >>= 1)
+                if (bits & 1) neg = !neg;
+            masks.m[table.lhs[k][p]][k] = neg ? -T() : T();
+        }
+    }
+    return masks;
+}
+
+/** Vectorised multiplication kernel
+  *
+  * Computes the product as a sum of dim terms: a broadcast component
+  * of the LHS times a signed permutation of the RHS. The terms are
+  * accumulated in the same order for every instruction set, so the
+  * results do not depend on the target (unless the compiler contracts
+  * them into fused multiply-adds), but they may differ from the scalar
+  * kernel in the last bits. Products of HypercomplexArray objects
+  * sum the terms in the same order and give the same results.
+  * Every component is within gamma_dim * sum_i |H1[i]| |H2[i ^ k]|
+  * of the exact product, where gamma_n = n u / (1 - n u) for the
+  * unit roundoff u of the base type.
+  *
+  * Template parameters are:
+  * * vector register traits
+  * * dimensionality of the algebra
+  */
+template <typename V, const unsigned int dim>
+struct SIMDMultiplication {
+    using T = typename V::value_type;
+    using R = typename V::type;
+    static constexpr unsigned int W = V::width;
+    static constexpr unsigned int N = dim / W;
+    static constexpr CayleyDicksonMasks<T, dim> masks =
+        cayley_dickson_masks<T, dim>();
+    static constexpr bool sequential = true;
+
+    // add the term H1[i] * H2[i ^ k] to the accumulators
+    template <unsigned int i>
+    static void term(const T *H1, const R *b, R *acc) {
+        const R x = V::broadcast(H1[i]);
+        for (unsigned int r=0; r < N; r++) {
+            R y = V::template permute<i % W>(b[r ^ (i / W)]);
+            y = V::mul(x, V::flip(y, V::load(&masks.m[i][r * W])));
+            if constexpr (i == 0) acc[r] = y;
+            else
+                acc[r] = V::add(acc[r], y);
+        }
+    }
+
+    template <unsigned int... i>
+    static void multiply(
+        const T *H1, const T *H2, T *out,
+        std::integer_sequence<unsigned int, i...>
+    ) {
+        R b[N], acc[N];
+        for (unsigned int r=0; r < N; r++) b[r] = V::load(H2 + r * W);
+        (term<i>(H1, b, acc), ...);
+        for (unsigned int r=0; r < N; r++) V::store(out + r * W, acc[r]);
+    }
+
+    static void multiply(const T *H1, const T *H2, T *out) {
+        multiply(H1, H2, out, std::make_integer_sequence<unsigned int, dim>());
+    }
+};
+
+// permutation of 4 lanes: lane l takes lane l ^ i
+#define HYPERCOMPLEX_XOR_SHUFFLE(i) \
+    _MM_SHUFFLE(3 ^ (i), 2 ^ (i), 1 ^ (i), 0 ^ (i))
+
+/** SSE2 register of 4 floats
+  */
+struct SSE2FloatVector {
+    using type = __m128;
+    using value_type = float;
+    static constexpr unsigned int width = 4;
+    static type load(const float *p) { return _mm_loadu_ps(p); }
+    static void store(float *p, type x) { _mm_storeu_ps(p, x); }
+    static type broadcast(float x) { return _mm_set1_ps(x); }
+    static type add(type x, type y) { return _mm_add_ps(x, y); }
+    static type mul(type x, type y) { return _mm_mul_ps(x, y); }
+    static type sqrt(type x) { return _mm_sqrt_ps(x); }
+    static type flip(type x, type m) { return _mm_xor_ps(x, m); }
+    template <unsigned int i>
+    static type permute(type x) {
+        return _mm_shuffle_ps(x, x, HYPERCOMPLEX_XOR_SHUFFLE(i));
+    }
+};
+
+/** SSE2 register of 2 doubles
+  */
+struct SSE2DoubleVector {
+    using type = __m128d;
+    using value_type = double;
+    static constexpr unsigned int width = 2;
+    static type load(const double *p) { return _mm_loadu_pd(p); }
+    static void store(double *p, type x) { _mm_storeu_pd(p, x); }
+    static type broadcast(double x) { return _mm_set1_pd(x); }
+    static type add(type x, type y) { return _mm_add_pd(x, y); }
+    static type mul(type x, type y) { return _mm_mul_pd(x, y); }
+    static type sqrt(type x) { return _mm_sqrt_pd(x); }
+    static type flip(type x, type m) { return _mm_xor_pd(x, m); }
+    template <unsigned int i>
+    static type permute(type x) {
+        return _mm_shuffle_pd(x, x, i | ((1 ^ i) << 1));
+    }
+};
+
+#if defined(__AVX2__)
+
+/** AVX2 register of 8 floats
+  */
+struct AVX2FloatVector {
+    using type = __m256;
+    using value_type = float;
+    static constexpr unsigned int width = 8;
+    static type load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, type x) { _mm256_storeu_ps(p, x); }
+    static type broadcast(float x) { return _mm256_set1_ps(x); }
+    static type add(type x, type y) { return _mm256_add_ps(x, y); }
+    static type mul(type x, type y) { return _mm256_mul_ps(x, y); }
+    static type sqrt(type x) { return _mm256_sqrt_ps(x); }
+    static type flip(type x, type m) { return _mm256_xor_ps(x, m); }
+    template <unsigned int i>
+    static type permute(type x) {
+        if constexpr ((i & 3) != 0)
+            x = _mm256_permute_ps(x, HYPERCOMPLEX_XOR_SHUFFLE(i & 3));
+        if constexpr ((i & 4) != 0)
+            x = _mm256_permute2f128_ps(x, x, 1);
+        return x;
+    }
+};
+
+/** AVX2 register of 4 doubles
+  */
+struct AVX2DoubleVector {
+    using type = __m256d;
+    using value_type = double;
+    static constexpr unsigned int width = 4;
+    static type load(const double *p) { return _mm256_loadu_pd(p); }
+    static void store(double *p, type x) { _mm256_storeu_pd(p, x); }
+    static type broadcast(double x) { return _mm256_set1_pd(x); }
+    static type add(type x, type y) { return _mm256_add_pd(x, y); }
+    static type mul(type x, type y) { return _mm256_mul_pd(x, y); }
+    static type sqrt(type x) { return _mm256_sqrt_pd(x); }
+    static type flip(type x, type m) { return _mm256_xor_pd(x, m); }
+    template <unsigned int i>
+    static type permute(type x) {
+        return _mm256_permute4x64_pd(x, HYPERCOMPLEX_XOR_SHUFFLE(i));
+    }
+};
+
+#endif
+
+#if defined(__AVX512F__)
+
+/** AVX-512 register of 8 doubles
+  */
+struct AVX512DoubleVector {
+    using type = __m512d;
+    using value_type = double;
+    static constexpr unsigned int width = 8;
+    static type load(const double *p) { return _mm512_loadu_pd(p); }
+    static void store(double *p, type x) { _mm512_storeu_pd(p, x); }
+    static type broadcast(double x) { return _mm512_set1_pd(x); }
+    static type add(type x, type y) { return _mm512_add_pd(x, y); }
+    static type mul(type x, type y) { return _mm512_mul_pd(x, y); }
+    // the masked forms with a full mask are the same instructions, but
+    // avoid _mm512_undefined_pd(), which GCC 12 reports as uninitialised
+    static type sqrt(type x) { return _mm512_mask_sqrt_pd(x, 0xFF, x); }
+    static type flip(type x, type m) {
+        return _mm512_castsi512_pd(_mm512_xor_si512(
+            _mm512_castpd_si512(x), _mm512_castpd_si512(m)));
+    }
+    template <unsigned int i>
+    static type permute(type x) {
+        if constexpr (i == 0) {
+            return x;  // no vpermpd for the identity
+        } else {
+            const __m512i index = _mm512_set_epi64(
+                7 ^ i, 6 ^ i, 5 ^ i, 4 ^ i, 3 ^ i, 2 ^ i, 1 ^ i, 0 ^ i);
+            return _mm512_mask_permutexvar_pd(x, 0xFF, index, x);
+        }
+    }
+};
+
+#endif
+
+#undef HYPERCOMPLEX_XOR_SHUFFLE
+
+// quaternions and octonions over float and double: widest registers
+// that the target supports, the remaining lanes are split over
+// several registers
+
+template <>
+struct HypercomplexKernel<float, 4> :
+    SIMDMultiplication<SSE2FloatVector, 4> {};
+
+#if defined(__AVX2__)
+template <>
+struct HypercomplexKernel<float, 8> :
+    SIMDMultiplication<AVX2FloatVector, 8> {};
+template <>
+struct HypercomplexKernel<double, 4> :
+    SIMDMultiplication<AVX2DoubleVector, 4> {};
+#else
+template <>
+struct HypercomplexKernel<float, 8> :
+    SIMDMultiplication<SSE2FloatVector, 8> {};
+template <>
+struct HypercomplexKernel<double, 4> :
+    SIMDMultiplication<SSE2DoubleVector, 4> {};
+#endif
+
+#if defined(__AVX512F__)
+template <>
+struct HypercomplexKernel<double, 8> :
+    SIMDMultiplication<AVX512DoubleVector, 8> {};
+#elif defined(__AVX2__)
+template <>
+struct HypercomplexKernel<double, 8> :
+    SIMDMultiplication<AVX2DoubleVector, 8> {};
+#else
+template <>
+struct HypercomplexKernel<double, 8> :
+    SIMDMultiplication<SSE2DoubleVector, 8> {};
+#endif
+
+/** Widest register of the target for operations over arrays
+  */
+template <typename T>
+struct WidestVector;
+
+#if defined(__AVX2__)
+template <>
+struct WidestVector<float> { using type = AVX2FloatVector; };
+#else
+template <>
+struct WidestVector<float> { using type = SSE2FloatVector; };
+#endif
+
+#if defined(__AVX512F__)
+template <>
+struct WidestVector<double> { using type = AVX512DoubleVector; };
+#elif defined(__AVX2__)
+template <>
+struct WidestVector<double> { using type = AVX2DoubleVector; };
+#else
+template <>
+struct WidestVector<double> { using type = SSE2DoubleVector; };
+#endif
+
+#endif
+
+// overloaded * binary operator
+template <typename T, const unsigned int dim>
+Hypercomplex<T, dim> operator*(
+    const Hypercomplex<T, dim> &H1,
+    const Hypercomplex<T, dim> &H2
+) {
+    T temparr[dim];
+    HypercomplexKernel<T, dim>::multiply(&H1[0], &H2[0], temparr);
+    Hypercomplex<T, dim> H(temparr);
+    return H;
+}
+
+// overloaded * binary operator for expressions
+template <typename E1, typename E2, typename T, const unsigned int dim>
+Hypercomplex<T, dim> operator*(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+) {
+    return Hypercomplex<T, dim>(H1) * Hypercomplex<T, dim>(H2);
+}
+
+// absolute value of an integer power (also for the minimal signed value)
+template <typename I>
+inline typename std::make_unsigned<I>::type power_magnitude(const I x) {
+    static_assert(std::is_integral<I>::value, "power must be an integer");
+    using U = typename std::make_unsigned<I>::type;
+    if constexpr (std::is_signed<I>::value) {
+        if (x < 0) return static_cast<U>(0) - static_cast<U>(x);
+    }
+    return static_cast<U>(x);
+}
+
+// overloaded ^ binary operator
+template <typename T, const unsigned int dim, typename I>
+Hypercomplex<T, dim> operator^(
+    const Hypercomplex<T, dim> &H,
+    const I x
+) {
+    auto n = power_magnitude(x);
+    if (!n) {
+        T temparr[dim] = {};
+        temparr[0] = T(1);
+        Hypercomplex<T, dim> H0(temparr);
+        return H0;
+    }
+    Hypercomplex<T, dim> base(H);
+    if constexpr (std::is_signed<I>::value) {
+        if (x < 0) base = H.inv();
+    }
+    // exponentiation by squaring (Cayley-Dickson algebras are
+    // power-associative, so the grouping of the products is arbitrary)
+    while (!(n & 1)) {
+        base *= base;
+        n >>= 1;
+    }
+    Hypercomplex<T, dim> Hx(base);
+    while (n >>= 1) {
+        base *= base;
+        if (n & 1) Hx *= base;
+    }
+    return Hx;
+}
+
+// overloaded ^ binary operator for expressions
+template <typename E, typename T, const unsigned int dim, typename I>
+Hypercomplex<T, dim> operator^(
+    const HypercomplexExpr<E, T, dim> &H,
+    const I x
+) {
+    return Hypercomplex<T, dim>(H) ^ x;
+}
+
+// overloaded / binary operator
+template <typename T, const unsigned int dim>
+Hypercomplex<T, dim> operator/(
+    const Hypercomplex<T, dim> &H1,
+    const Hypercomplex<T, dim> &H2
+) {
+    // fused H1 / H2 = (H1 ~H2) / |H2|^2, one division per component
+    T conj[dim], temparr[dim];
+    const T norm2 = divisor_conjugate<T, dim>(&H2[0], conj);
+    HypercomplexKernel<T, dim>::multiply(&H1[0], conj, temparr);
+    for (unsigned int i=0; i < dim; i++) temparr[i] = temparr[i] / norm2;
+    Hypercomplex<T, dim> H(temparr);
+    return H;
+}
+
+// overloaded / binary operator for expressions
+template <typename E1, typename E2, typename T, const unsigned int dim>
+Hypercomplex<T, dim> operator/(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+) {
+    return Hypercomplex<T, dim>(H1) / Hypercomplex<T, dim>(H2);
+}
+
+// overloaded += operator
+template <typename T, const unsigned int dim>
+template <typename E>
+inline Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator+=(
+    const HypercomplexExpr<E, T, dim> &H
+) {
+    for (unsigned int i=0; i < dim; i++) arr[i] += H[i];
+    return *this;
+}
+
+// overloaded -= operator
+template <typename T, const unsigned int dim>
+template <typename E>
+inline Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator-=(
+    const HypercomplexExpr<E, T, dim> &H
+) {
+    for (unsigned int i=0; i < dim; i++) arr[i] -= H[i];
+    return *this;
+}
+
+// overloaded *= operator
+template <typename T, const unsigned int dim>
+Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator*=(
+    const Hypercomplex<T, dim> &H
+) {
+    // the product is written over the LHS, which is saved beforehand
+    T temparr[dim];
+    for (unsigned int i=0; i < dim; i++) temparr[i] = arr[i];
+    const T *rhs = (&H == this) ? temparr : &H[0];
+    HypercomplexKernel<T, dim>::multiply(temparr, rhs, arr.data());
+    return *this;
+}
+
+// overloaded ^= operator
+template <typename T, const unsigned int dim>
+template <typename I>
+Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator^=(const I x) {
+    *this = (*this) ^ x;
+    return *this;
+}
+
+// overloaded /= operator
+template <typename T, const unsigned int dim>
+Hypercomplex<T, dim>& Hypercomplex<T, dim>::operator/=(
+    const Hypercomplex<T, dim> &H
+) {
+    // fused as operator/, the quotient is written over the LHS
+    T conj[dim], temparr[dim];
+    const T norm2 = divisor_conjugate<T, dim>(&H[0], conj);
+    for (unsigned int i=0; i < dim; i++) temparr[i] = arr[i];
+    HypercomplexKernel<T, dim>::multiply(temparr, conj, arr.data());
+    for (unsigned int i=0; i < dim; i++) arr[i] = arr[i] / norm2;
+    return *this;
+}
+
+// overload << operator
+template <typename E, typename T, const unsigned int dim>
+std::ostream& operator<< (
+    std::ostream &os,
+    const HypercomplexExpr<E, T, dim> &H
+) {
+    using hypercomplex_math::operator<<;
+    for (unsigned int i=0; i < dim - 1; i++) os << H[i] << " ";
+    os << H[dim - 1];
+    return os;
+}
+
+// return the real part of the number
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> Re(const HypercomplexExpr<E, T, dim> &H) {
+    Hypercomplex<T, dim> result = H;
+    for (unsigned int i=1; i < dim; i++) result[i] = T();
+    return result;
+}
+
+// return the imaginary part of the number
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> Im(const HypercomplexExpr<E, T, dim> &H) {
+    Hypercomplex<T, dim> result = H;
     result[0] = T();
     return result;
 }
 
-// calculate e^H
-template <typename T, const unsigned int dim>
-Hypercomplex<T, dim> exp(const Hypercomplex<T, dim> &H) {
-    Hypercomplex<T, dim> result = Im(H);
-    T zero = T();
-    T norm = result.norm();
-    if (norm == zero) {
-        result[0] = exp(H[0]);
-        for (unsigned int i=1; i < dim; i++) result[i] = zero;
+// calculate e^H = e^Re(H) (cos|v| + v sin|v| / |v|) with v = Im(H);
+// the scalar factors are computed once and applied in a single pass
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> exp(const HypercomplexExpr<E, T, dim> &H) {
+    using hypercomplex_math::exp;
+    using hypercomplex_math::sin_cos;
+    Hypercomplex<T, dim> result = Im(H);
+    const T zero = T();
+    const T norm = result.norm();
+    const auto exp_re = exp(H[0]);  // as in exp() of HypercomplexArray
+    if (norm == zero) {
+        result[0] = exp_re;
+        for (unsigned int i=1; i < dim; i++) result[i] = zero;
+    } else {
+        T sin_norm, cos_norm;
+        sin_cos(norm, sin_norm, cos_norm);
+        const T scale = exp_re * (sin_norm / norm);
+        result[0] = exp_re * cos_norm;
+        for (unsigned int i=1; i < dim; i++) result[i] = result[i] * scale;
+    }
+    return result;
+}
+
+// squared norm of the imaginary part of a number
+template <typename T, const unsigned int dim>
+T imaginary_norm2(const Hypercomplex<T, dim> &H) {
+    T result = T();
+    for (unsigned int i=1; i < dim; i++) result = result + H[i] * H[i];
+    return result;
+}
+
+// calculate log(H) = log|H| + v arg(H) / |v| with v = Im(H) and
+// arg(H) = atan2(|v|, Re(H)); v is replaced by e_1 for real numbers
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> log(const HypercomplexExpr<E, T, dim> &H) {
+    using hypercomplex_math::log;
+    using hypercomplex_math::sqrt;
+    using hypercomplex_math::atan2;
+    Hypercomplex<T, dim> result = H;
+    const T zero = T();
+    const T re = result[0];
+    if (dim == 1) {
+        result[0] = log(re);
+        return result;
+    }
+    const T norm2 = imaginary_norm2(result);
+    const T norm = sqrt(norm2);
+    const T arg = atan2(norm, re);
+    result[0] = log(sqrt(re * re + norm2));
+    if (norm == zero) {
+        for (unsigned int i=1; i < dim; i++) result[i] = zero;
+        result[1] = arg;
+    } else {
+        const T scale = arg / norm;
+        for (unsigned int i=1; i < dim; i++) result[i] = result[i] * scale;
+    }
+    return result;
+}
+
+// calculate sqrt(H) from w = sqrt((|H| + |Re(H)|) / 2), which is the
+// real part for Re(H) >= 0 and the norm of the imaginary part otherwise
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> sqrt(const HypercomplexExpr<E, T, dim> &H) {
+    using hypercomplex_math::sqrt;
+    Hypercomplex<T, dim> result = H;
+    const T zero = T();
+    const T re = result[0];
+    if (dim == 1) {
+        result[0] = sqrt(re);
+        return result;
+    }
+    const T norm2 = imaginary_norm2(result);
+    const T norm = sqrt(norm2);
+    const bool negative = re < zero;
+    const T w = sqrt((sqrt(re * re + norm2) + (negative ? -re : re)) *
+        T(0.5));
+    if (w == zero) return result;  // zero with its signs
+    const T half_inv = T(0.5) / w;
+    result[0] = negative ? norm * half_inv : w;
+    if (norm == zero) {
+        for (unsigned int i=1; i < dim; i++) result[i] = zero;
+        if (negative) result[1] = w;
+    } else {
+        const T scale = negative ? w / norm : half_inv;
+        for (unsigned int i=1; i < dim; i++) result[i] = result[i] * scale;
+    }
+    return result;
+}
+
+// integral value n of an exponent p with |p| < 2^31, if it has one
+template <typename T>
+bool integral_exponent(const T &p, long &n) {
+    const T limit = T(2147483648.0);
+    if (!(p < limit && -p < limit)) return false;  // also for NaN
+    n = static_cast<long>(static_cast<double>(p));
+    return T(static_cast<double>(n)) == p;
+}
+
+// calculate H^p = |H|^p (cos(p arg(H)) + v sin(p arg(H)) / |v|)
+// with v = Im(H), replaced by e_1 for real numbers
+template <typename E, typename T, const unsigned int dim>
+Hypercomplex<T, dim> pow(
+    const HypercomplexExpr<E, T, dim> &H,
+    const typename HypercomplexExpr<E, T, dim>::value_type &p
+) {
+    using hypercomplex_math::real_pow;
+    using hypercomplex_math::sqrt;
+    using hypercomplex_math::exp;
+    using hypercomplex_math::log;
+    using hypercomplex_math::atan2;
+    using hypercomplex_math::sin_cos;
+    Hypercomplex<T, dim> result = H;
+    const T zero = T();
+    const T re = result[0];
+    if (p == zero) {
+        // also for zero, infinite and NaN numbers
+        result[0] = T(1);
+        for (unsigned int i=1; i < dim; i++) result[i] = zero;
+        return result;
+    }
+    if (p < zero) {
+        // 0^p = 1 / 0^-p, a division by zero as in inv()
+        bool is_zero = true;
+        for (unsigned int i=0; i < dim; i++)
+            is_zero = is_zero && result[i] == zero;
+        if (is_zero) throw std::invalid_argument("division by zero");
+    }
+    long n;
+    if (integral_exponent(p, n)) return result ^ n;
+    if (dim == 1) {
+        result[0] = real_pow(re, p);
+        return result;
+    }
+    const T norm2 = imaginary_norm2(result);
+    const T norm = sqrt(norm2);
+    const T modulus2 = re * re + norm2;
+    if (modulus2 == zero && p > zero) {
+        // 0^p = 0 without the infinite logarithm
+        for (unsigned int i=0; i < dim; i++) result[i] = zero;
+        return result;
+    }
+    const T modulus = exp(p * log(sqrt(modulus2)));
+    T sin_arg, cos_arg;
+    sin_cos(p * atan2(norm, re), sin_arg, cos_arg);
+    result[0] = modulus * cos_arg;
+    if (norm == zero) {
+        for (unsigned int i=1; i < dim; i++) result[i] = zero;
+        result[1] = modulus * sin_arg;
+    } else {
+        const T scale = modulus * (sin_arg / norm);
+        for (unsigned int i=1; i < dim; i++) result[i] = result[i] * scale;
+    }
+    return result;
+}
+
+// calculate H1^H2 = exp(log(H1) H2)
+template <typename E1, typename E2, typename T, const unsigned int dim>
+Hypercomplex<T, dim> pow(
+    const HypercomplexExpr<E1, T, dim> &H1,
+    const HypercomplexExpr<E2, T, dim> &H2
+) {
+    return exp(log(H1) * H2);
+}
+
+// allocate zero-initialised lanes, each one aligned to a cache line
+template <typename T, const unsigned int dim>
+void HypercomplexArray<T, dim>::allocate(const std::size_t size) {
+    if (dim == 0) throw std::invalid_argument("invalid dimension");
+    if ((dim & (dim - 1)) != 0) {
+        throw std::invalid_argument("invalid dimension");
+    }
+    const std::size_t line = std::max<std::size_t>(alignment / sizeof(T), 1);
+    n = size;
+    stride = (size + line - 1) / line * line;
+    data = nullptr;
+    if (stride) {
+        data = static_cast<T*>(::operator new[](
+            dim * stride * sizeof(T), std::align_val_t(alignment)));
+        std::uninitialized_fill_n(data, dim * stride, T());
+    }
+}
+
+// release the lanes
+template <typename T, const unsigned int dim>
+void HypercomplexArray<T, dim>::release() {
+    if (data) ::operator delete[](data, std::align_val_t(alignment));
+    data = nullptr;
+    n = stride = 0;
+}
+
+// HypercomplexArray main constructor
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim>::HypercomplexArray(const std::size_t size) {
+    allocate(size);
+}
+
+// HypercomplexArray copy constructor
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim>::HypercomplexArray(const HypercomplexArray &A) {
+    allocate(A.n);
+    std::copy_n(A.data, dim * stride, data);
+}
+
+// HypercomplexArray move constructor
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim>::HypercomplexArray(
+    HypercomplexArray &&A
+) noexcept : n(A.n), stride(A.stride), data(A.data) {
+    A.data = nullptr;
+    A.n = A.stride = 0;
+}
+
+// HypercomplexArray destructor
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim>::~HypercomplexArray() {
+    release();
+}
+
+// overloaded = operator
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim>& HypercomplexArray<T, dim>::operator=(
+    const HypercomplexArray &A
+) {
+    if (this == &A) return *this;
+    if (n != A.n) {
+        release();
+        allocate(A.n);
+    }
+    std::copy_n(A.data, dim * stride, data);
+    return *this;
+}
+
+// overloaded = operator for temporary objects
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim>& HypercomplexArray<T, dim>::operator=(
+    HypercomplexArray &&A
+) noexcept {
+    std::swap(n, A.n);
+    std::swap(stride, A.stride);
+    std::swap(data, A.data);
+    return *this;
+}
+
+// access the i-th component lane
+template <typename T, const unsigned int dim>
+inline T* HypercomplexArray<T, dim>::lane(const unsigned int i) {
+    assert(0 <= i && i < dim);
+    return data + i * stride;
+}
+
+// access the i-th component lane of const objects
+template <typename T, const unsigned int dim>
+inline const T* HypercomplexArray<T, dim>::lane(const unsigned int i) const {
+    assert(0 <= i && i < dim);
+    return data + i * stride;
+}
+
+// gather the j-th element
+template <typename T, const unsigned int dim>
+Hypercomplex<T, dim> HypercomplexArray<T, dim>::get(
+    const std::size_t j
+) const {
+    if (j >= n) throw std::out_of_range("index out of range");
+    T temparr[dim];
+    for (unsigned int i=0; i < dim; i++) temparr[i] = data[i * stride + j];
+    Hypercomplex<T, dim> H(temparr);
+    return H;
+}
+
+// scatter the j-th element
+template <typename T, const unsigned int dim>
+void HypercomplexArray<T, dim>::set(
+    const std::size_t j,
+    const Hypercomplex<T, dim> &H
+) {
+    if (j >= n) throw std::out_of_range("index out of range");
+    for (unsigned int i=0; i < dim; i++) data[i * stride + j] = H[i];
+}
+
+// calculate norms of all elements
+template <typename T, const unsigned int dim>
+std::vector<T> HypercomplexArray<T, dim>::norm() const {
+    using hypercomplex_math::sqrt;
+    std::vector<T> result(n, T());
+    for (unsigned int i=0; i < dim; i++) {
+        const T *a = lane(i);
+        for (std::size_t j=0; j < n; j++)
+            result[j] = result[j] + a[j] * a[j];
+    }
+    for (std::size_t j=0; j < n; j++) result[j] = sqrt(result[j]);
+    return result;
+}
+
+// calculate inverses of all elements
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> HypercomplexArray<T, dim>::inv() const {
+    // squared norms summed as in inv() of a single number
+    std::vector<T> norm2(n, T());
+    for (unsigned int i=0; i < dim; i++) {
+        const T *a = lane(i);
+        for (std::size_t j=0; j < n; j++)
+            norm2[j] = norm2[j] + a[j] * a[j];
+    }
+    for (std::size_t j=0; j < n; j++) {
+        if (norm2[j] == T()) throw std::invalid_argument("division by zero");
+    }
+    HypercomplexArray<T, dim> A(n);
+    const T *a = lane(0);
+    T *b = A.lane(0);
+    for (std::size_t j=0; j < n; j++) b[j] = a[j] / norm2[j];
+    for (unsigned int i=1; i < dim; i++) {
+        a = lane(i);
+        b = A.lane(i);
+        for (std::size_t j=0; j < n; j++) b[j] = -a[j] / norm2[j];
+    }
+    return A;
+}
+
+// overloaded ~ operator for arrays
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator~(const HypercomplexArray<T, dim> &A) {
+    HypercomplexArray<T, dim> B(A);
+    for (unsigned int i=1; i < dim; i++) {
+        T *b = B.lane(i);
+        for (std::size_t j=0; j < B.size(); j++) b[j] = -b[j];
+    }
+    return B;
+}
+
+// overloaded + binary operator for arrays
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator+(
+    const HypercomplexArray<T, dim> &A1,
+    const HypercomplexArray<T, dim> &A2
+) {
+    if (A1.size() != A2.size()) throw std::invalid_argument("size mismatch");
+    HypercomplexArray<T, dim> A(A1.size());
+    for (unsigned int i=0; i < dim; i++) {
+        const T *a1 = A1.lane(i), *a2 = A2.lane(i);
+        T *a = A.lane(i);
+        for (std::size_t j=0; j < A.size(); j++) a[j] = a1[j] + a2[j];
+    }
+    return A;
+}
+
+// overloaded - binary operator for arrays
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator-(
+    const HypercomplexArray<T, dim> &A1,
+    const HypercomplexArray<T, dim> &A2
+) {
+    if (A1.size() != A2.size()) throw std::invalid_argument("size mismatch");
+    HypercomplexArray<T, dim> A(A1.size());
+    for (unsigned int i=0; i < dim; i++) {
+        const T *a1 = A1.lane(i), *a2 = A2.lane(i);
+        T *a = A.lane(i);
+        for (std::size_t j=0; j < A.size(); j++) a[j] = a1[j] - a2[j];
+    }
+    return A;
+}
+
+// overloaded * binary operator for arrays
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> operator*(
+    const HypercomplexArray<T, dim> &A1,
+    const HypercomplexArray<T, dim> &A2
+) {
+    if (A1.size() != A2.size()) throw std::invalid_argument("size mismatch");
+    static constexpr CayleyDicksonTable<dim> table =
+        cayley_dickson_table<dim>();
+    constexpr unsigned int levels = cayley_dickson_levels(dim);
+    constexpr std::size_t block = HypercomplexArray<T, dim>::block;
+    HypercomplexArray<T, dim> A(A1.size());
+    if constexpr (ReducedMultiplication<T>::value) {
+        // element by element, as in operator* of single numbers
+        T x[dim], y[dim], z[dim];  // NOLINT
+        for (std::size_t j=0; j < A.size(); j++) {
+            for (unsigned int i=0; i < dim; i++) {
+                x[i] = A1.lane(i)[j];
+                y[i] = A2.lane(i)[j];
+            }
+            cayley_dickson_reduced_multiply<T, dim>(x, y, z);
+            for (unsigned int i=0; i < dim; i++) A.lane(i)[j] = z[i];
+        }
+        return A;
+    }
+    if constexpr (HypercomplexKernel<T, dim>::sequential) {
+        // terms H1[i] * H2[i ^ k] summed in the order of the
+        // vectorised kernel, so that the results match operator*
+        using Kernel = HypercomplexKernel<T, dim>;
+        for (unsigned int k=0; k < dim; k++) {
+            T *a = A.lane(k);
+            for (unsigned int i=0; i < dim; i++) {
+                const T *x = A1.lane(i), *y = A2.lane(i ^ k);
+                const std::size_t n = A.size();
+                if (std::signbit(Kernel::masks.m[i][k])) {
+                    if (i == 0) {
+                        for (std::size_t j=0; j < n; j++) a[j] = -(x[j] * y[j]);
+                    } else {
+                        for (std::size_t j=0; j < n; j++) a[j] -= x[j] * y[j];
+                    }
+                } else {
+                    if (i == 0) {
+                        for (std::size_t j=0; j < n; j++) a[j] = x[j] * y[j];
+                    } else {
+                        for (std::size_t j=0; j < n; j++) a[j] += x[j] * y[j];
+                    }
+                }
+            }
+        }
+        return A;
+    }
+    // pending partial sums of the pairwise reduction, one per level
+    T partial[levels + 1][block];
+    T leaf[block];
+    for (std::size_t start=0; start < A.size(); start += block) {
+        const std::size_t len = std::min(block, A.size() - start);
+        for (unsigned int k=0; k < dim; k++) {
+            for (unsigned int p=0; p < dim; p++) {
+                const T *x = A1.lane(table.lhs[k][p]) + start;
+                const T *y = A2.lane(table.rhs[k][p]) + start;
+                if (table.neg[k][p]) {
+                    for (std::size_t j=0; j < len; j++)
+                        leaf[j] = -(x[j] * y[j]);
+                } else {
+                    for (std::size_t j=0; j < len; j++) leaf[j] = x[j] * y[j];
+                }
+                // leaf p completes the pairs of all levels given by
+                // its trailing one bits, see cayley_dickson_multiply()
+                unsigned int level = 0;
+                for (unsigned int q = p; q & 1; q >>= 1, level++) {
+                    const T *z = partial[level];
+                    if (k & (1u << level)) {
+                        for (std::size_t j=0; j < len; j++)
+                            leaf[j] = z[j] + leaf[j];
+                    } else {
+                        for (std::size_t j=0; j < len; j++)
+                            leaf[j] = z[j] - leaf[j];
+                    }
+                }
+                std::copy_n(leaf, len, partial[level]);
+            }
+            std::copy_n(partial[levels], len, A.lane(k) + start);
+        }
+    }
+    return A;
+}
+
+// calculate e^A for all elements
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> exp(const HypercomplexArray<T, dim> &A) {
+    using hypercomplex_math::sqrt;
+    using hypercomplex_math::exp;
+    using hypercomplex_math::sin_cos;
+    HypercomplexArray<T, dim> B(A.size());
+    // norms of the imaginary parts
+    std::vector<T> norm(A.size(), T());
+    for (unsigned int i=1; i < dim; i++) {
+        const T *a = A.lane(i);
+        for (std::size_t j=0; j < A.size(); j++)
+            norm[j] = norm[j] + a[j] * a[j];
+    }
+    // real parts and scaling factors of the imaginary parts,
+    // rounded in the same steps as exp() of a single number
+    const T zero = T();
+    std::vector<T> scale(A.size());
+    const T *a0 = A.lane(0);
+    T *b0 = B.lane(0);
+    for (std::size_t j=0; j < A.size(); j++) {
+        norm[j] = sqrt(norm[j]);
+        const auto exp_re = exp(a0[j]);
+        if (norm[j] == zero) {
+            b0[j] = exp_re;
+        } else {
+            T sin_norm, cos_norm;
+            sin_cos(norm[j], sin_norm, cos_norm);
+            scale[j] = exp_re * (sin_norm / norm[j]);
+            b0[j] = exp_re * cos_norm;
+        }
+    }
+    for (unsigned int i=1; i < dim; i++) {
+        const T *a = A.lane(i);
+        T *b = B.lane(i);
+        for (std::size_t j=0; j < A.size(); j++)
+            b[j] = norm[j] == zero ? zero : a[j] * scale[j];
+    }
+    return B;
+}
+
+/** Worker threads of the batch operations
+  *
+  * Created on first use and kept until the program ends, so the
+  * thread-local state of the workers (e.g. pools of MPFR variables)
+  * survives between calls. The pool grows to the largest number of
+  * threads requested so far. One job runs at a time: a call made
+  * while the workers are busy (e.g. from inside a job) runs on the
+  * calling thread only.
+  */
+class ParallelWorkers {
+ public:
+    /** \brief Shared instance
+      * \return pool of worker threads
+      */
+    static ParallelWorkers &instance() {
+        static ParallelWorkers workers;
+        return workers;
+    }
+
+    /** \brief Run a job on the caller and on worker threads
+      * \param [in] helpers number of worker threads besides the caller
+      * \param [in] job function called once on every thread
+      *
+      * Returns when all threads are done with the job. Fewer workers
+      * take part if no more threads can be created.
+      */
+    void run(std::size_t helpers, const std::function<void()> &job) {
+        if (in_job()) {
+            job();
+            return;
+        }
+        std::unique_lock<std::mutex> busy(run_mutex, std::try_to_lock);
+        if (!busy.owns_lock()) helpers = 0;
+        if (helpers) {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (threads.size() < helpers) {
+                try {
+                    threads.emplace_back([this]() { loop(); });
+                } catch (const std::system_error&) {
+                    break;  // continue with the threads created so far
+                }
+            }
+            current = &job;
+            pending = std::min(helpers, threads.size());
+            generation++;
+        }
+        wake.notify_all();
+        in_job() = true;
+        job();
+        in_job() = false;
+        if (!helpers) return;
+        // slots not claimed by now would find no work left
+        std::unique_lock<std::mutex> lock(mutex);
+        pending = 0;
+        done.wait(lock, [this]() { return running == 0; });
+        current = nullptr;
+    }
+
+    /** \brief Register a function to call when the worker thread ends
+      * \param [in] cleanup function, registered once per thread
+      */
+    static void at_exit(void (*cleanup)()) {
+        std::vector<void (*)()> &hooks = exit_hooks();
+        if (std::find(hooks.begin(), hooks.end(), cleanup) == hooks.end())
+            hooks.push_back(cleanup);
+    }
+
+    ~ParallelWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &thread : threads) thread.join();
+    }
+
+ private:
+    std::mutex run_mutex;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::vector<std::thread> threads;
+    const std::function<void()> *current = nullptr;
+    std::size_t pending = 0;
+    std::size_t running = 0;
+    std::size_t generation = 0;
+    bool stopping = false;
+
+    ParallelWorkers() = default;
+    ParallelWorkers(const ParallelWorkers&) = delete;
+    ParallelWorkers &operator=(const ParallelWorkers&) = delete;
+
+    static bool &in_job() {
+        thread_local bool flag = false;
+        return flag;
+    }
+
+    static std::vector<void (*)()> &exit_hooks() {
+        thread_local std::vector<void (*)()> hooks;
+        return hooks;
+    }
+
+    void loop() {
+        in_job() = true;
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wake.wait(lock, [&]() {
+                return stopping || (pending && seen != generation);
+            });
+            if (stopping) break;
+            seen = generation;
+            pending--;
+            running++;
+            const std::function<void()> &job = *current;
+            lock.unlock();
+            job();
+            lock.lock();
+            if (--running == 0) done.notify_all();
+        }
+        lock.unlock();
+        for (void (*cleanup)() : exit_hooks()) cleanup();
+    }
+};
+
+// run body(begin, end) over chunks of [0, n) on several threads
+template <typename T, typename F>
+void parallel_for(
+    const std::size_t n,
+    const ParallelOptions &options,
+    const F &body
+) {
+    std::size_t threads = options.threads;
+    if (!threads) threads = std::max(std::thread::hardware_concurrency(), 1u);
+    std::size_t grain = options.grain;
+    if (!grain) grain = std::max<std::size_t>(n / (8 * threads), 1);
+    const std::size_t chunks = n / grain + (n % grain != 0);  // no overflow
+    threads = std::min(threads, chunks);
+    if (!ParallelContext<T>::concurrent()) threads = 1;
+    const typename ParallelContext<T>::State state =
+        ParallelContext<T>::capture();
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<std::size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto work = [&]() {
+        if (std::this_thread::get_id() != caller) {
+            ParallelWorkers::at_exit(&ParallelContext<T>::worker_exit);
+            ParallelContext<T>::worker_enter(state);
+        }
+        std::size_t chunk;
+        while (!failed && (chunk = next++) < chunks) {
+            const std::size_t begin = chunk * grain;
+            try {
+                body(begin, begin + std::min(grain, n - begin));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) error = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+    // the caller works as well, so it needs one helper less
+    if (threads > 1) {
+        ParallelWorkers::instance().run(threads - 1, work);
+    } else {
+        work();
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+// multiply arrays of numbers on several threads
+template <typename T, const unsigned int dim>
+void parallel_multiply(
+    const Hypercomplex<T, dim> *H1,
+    const Hypercomplex<T, dim> *H2,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n,
+    const ParallelOptions &options
+) {
+    parallel_for<T>(n, options, [=](std::size_t begin, std::size_t end) {
+        for (std::size_t j=begin; j < end; j++) out[j] = H1[j] * H2[j];
+    });
+}
+
+// divide arrays of numbers on several threads
+template <typename T, const unsigned int dim>
+void parallel_divide(
+    const Hypercomplex<T, dim> *H1,
+    const Hypercomplex<T, dim> *H2,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n,
+    const ParallelOptions &options
+) {
+    parallel_for<T>(n, options, [=](std::size_t begin, std::size_t end) {
+        for (std::size_t j=begin; j < end; j++) out[j] = H1[j] / H2[j];
+    });
+}
+
+// calculate e^H for arrays of numbers on several threads
+template <typename T, const unsigned int dim>
+void parallel_exp(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n,
+    const ParallelOptions &options
+) {
+    parallel_for<T>(n, options, [=](std::size_t begin, std::size_t end) {
+        for (std::size_t j=begin; j < end; j++) out[j] = exp(H[j]);
+    });
+}
+
+// calculate norms of arrays of numbers on several threads
+template <typename T, const unsigned int dim>
+void parallel_norm(
+    const Hypercomplex<T, dim> *H,
+    T *out,
+    const std::size_t n,
+    const ParallelOptions &options
+) {
+    parallel_for<T>(n, options, [=](std::size_t begin, std::size_t end) {
+        for (std::size_t j=begin; j < end; j++) out[j] = H[j].norm();
+    });
+}
+
+/*
+###############################################################################
+#
+#   Vectorised elementary functions for float and double
+#
+###############################################################################
+*/
+
+/** Branch-free elementary functions of float and double
+  *
+  * Every function is a short sequence of arithmetic, bit operations
+  * and selects without calls or table lookups, so loops over arrays
+  * of arguments are vectorised by the compiler (e.g. with -O3).
+  * Arguments are reduced with constants split into parts whose
+  * products with the reduction multiple are exact, and the reduced
+  * arguments go through Taylor polynomials whose truncation error is
+  * below a tenth of an ulp. Error bounds, checked against MPFR:
+  *
+  * function  | float   | double  | valid arguments
+  * --------- | ------- | ------- | -----------------------------------
+  * exp       | 2 ulp   | 2 ulp   | all, including gradual underflow
+  * log       | 1 ulp   | 1 ulp   | all
+  * sin_cos   | 3 ulp   | 3 ulp   | \|x\| <= sin_cos_max (2^12, 2^20)
+  * atan2     | 3 ulp   | 3 ulp   | y >= 0
+  *
+  * Special values (zeros, infinities, NaN) are handled as by the
+  * standard library, except for sin_cos beyond its range.
+  */
+template <typename T>
+struct VectorMath {
+    static_assert(
+        std::is_same<T, float>::value || std::is_same<T, double>::value,
+        "VectorMath requires float or double"
+    );
+    static constexpr bool wide = std::is_same<T, double>::value;
+    using U = typename std::conditional<wide, uint64_t, uint32_t>::type;
+    using I = typename std::conditional<wide, int64_t, int32_t>::type;
+    static constexpr int mantissa = std::numeric_limits<T>::digits - 1;
+    static constexpr I bias = std::numeric_limits<T>::max_exponent - 1;
+
+    /** Largest argument of sin_cos() */
+    static constexpr T sin_cos_max = wide ? 0x1p20 : 0x1p12;
+
+    // coefficients (-1)^i / k or (-1)^i / k! with k = first + step i
+    template <std::size_t n>
+    static constexpr std::array<T, n> series(
+        const unsigned int first,
+        const unsigned int step,
+        const bool factorial,
+        const bool alternating
+    ) {
+        std::array<T, n> c{};
+        double f = 1.0;
+        unsigned int m = 1;
+        for (std::size_t i=0; i < n; i++) {
+            const unsigned int k = first + step * static_cast<unsigned>(i);
+            while (factorial && m <= k) f *= m++;
+            const double sign = alternating && (i & 1) ? -1.0 : 1.0;
+            c[i] = static_cast<T>(sign / (factorial ? f : k));
+        }
+        return c;
+    }
+
+    // c[i] + x c[i + 1] + x^2 c[i + 2] + ..., unrolled at compile time
+    template <std::size_t i = 0, std::size_t n>
+    static T horner(const T x, const std::array<T, n> &c) {
+        if constexpr (i + 1 == n) {
+            return c[i];
+        } else {
+            return c[i] + x * horner<i + 1>(x, c);
+        }
+    }
+
+    static U bits(const T x) {
+        U u;
+        std::memcpy(&u, &x, sizeof(T));
+        return u;
+    }
+
+    static T value(const U u) {
+        T x;
+        std::memcpy(&x, &u, sizeof(T));
+        return x;
+    }
+
+    /** \brief Branch-free selection
+      * \param [in] condition selector
+      * \param [in] x value if the condition holds
+      * \param [in] y value otherwise
+      * \return x or y
+      *
+      * Conditional expressions of floating-point numbers turn into
+      * branches that keep loops from being vectorised.
+      */
+    static T select(const bool condition, const T x, const T y) {
+        const U mask = static_cast<U>(0) - static_cast<U>(condition);
+        return value((bits(x) & mask) | (bits(y) & ~mask));
+    }
+
+    // 2^k for exponents k of normal numbers
+    static T pow2(const I k) {
+        return value(static_cast<U>(k + bias) << mantissa);
+    }
+
+    // integers of magnitude below 2^(mantissa - 1) are the differences
+    // of the bits of shifter + k and shifter
+    static constexpr T shifter = wide ? 0x1.8p52 : 0x1.8p23;
+
+    // nearest integer to x (|x| < 2^(mantissa - 1)), also as integer k
+    static T round(const T x, I &k) {
+        const T t = x + shifter;
+        k = static_cast<I>(bits(t) - bits(shifter));
+        return t - shifter;
+    }
+
+    // conversion of an integer k (|k| < 2^(mantissa - 1))
+    static T to_float(const I k) {
+        return value(bits(shifter) + static_cast<U>(k)) - shifter;
+    }
+
+    /** \brief Exponential function
+      * \param [in] x argument
+      * \return e^x
+      */
+    static T exp(T x) {
+        static constexpr auto c = series<wide ? 14 : 8>(0, 1, true, false);
+        const T ln2_hi = wide ? 0x1.62e42fefa38p-1 : 0x1.62e4p-1;
+        const T ln2_lo = wide ? 0x1.ef35793c7673p-45 : 0x1.7f7d1cp-20;
+        const T log2e = wide ? 0x1.71547652b82fep+0 : 0x1.715476p+0;
+        // beyond these bounds the result overflows or underflows
+        const T hi = wide ? 710 : 89, lo = wide ? -746 : -104;
+        x = select(x > hi, hi, x);
+        x = select(x < lo, lo, x);
+        // x = k ln(2) + r with |r| <= ln(2) / 2
+        I k;
+        const T kf = round(x * log2e, k);
+        const T r = (x - kf * ln2_hi) - kf * ln2_lo;
+        // two factors 2^(k/2) keep the scaling within normal exponents
+        const I k1 = k / 2;
+        return horner(r, c) * pow2(k1) * pow2(k - k1);
+    }
+
+    /** \brief Natural logarithm
+      * \param [in] x argument
+      * \return log(x)
+      */
+    static T log(const T x) {
+        // 2 / (2i + 3) for log(m) = f - f^2/2 + s (f^2/2 + z R(z))
+        static constexpr auto c = series<wide ? 10 : 5>(3, 2, false, false);
+        const T ln2_hi = wide ? 0x1.62e42fefa38p-1 : 0x1.62e4p-1;
+        const T ln2_lo = wide ? 0x1.ef35793c7673p-45 : 0x1.7f7d1cp-20;
+        const T sqrt2 = wide ? 0x1.6a09e667f3bcdp+0 : 0x1.6a09e6p+0;
+        // x = 2^e m with m in [sqrt(1/2), sqrt(2)), subnormals rescaled
+        const bool subnormal = x < std::numeric_limits<T>::min();
+        const U u = bits(select(subnormal, x * pow2(mantissa + 1), x));
+        const U exponent_mask = (U(1) << (sizeof(T) * 8 - 1 - mantissa)) - 1;
+        const U mantissa_mask = (U(1) << mantissa) - 1;
+        I e = static_cast<I>((u >> mantissa) & exponent_mask) - bias;
+        e -= subnormal * (mantissa + 1);
+        T m = value((u & mantissa_mask) | bits(T(1)));
+        const bool high = m > sqrt2;
+        m = select(high, m * T(0.5), m);
+        e += high;
+        // log(m) with f = m - 1 and s = f / (2 + f)
+        const T f = m - T(1);
+        const T s = f / (m + T(1));
+        const T z = s * s;
+        const T hfsq = T(0.5) * f * f;
+        const T R = T(2) * z * horner(z, c);
+        const T ef = to_float(e);
+        T result = ef * ln2_hi - ((hfsq - (s * (hfsq + R) + ef * ln2_lo)) - f);
+        const T inf = std::numeric_limits<T>::infinity();
+        result = select(x == inf, inf, result);
+        result = select(x == T(0), -inf, result);
+        return select(x >= T(0), result, std::numeric_limits<T>::quiet_NaN());
+    }
+
+    /** \brief Sine and cosine
+      * \param [in] x argument, |x| <= sin_cos_max
+      * \param [out] sin_x sine of x
+      * \param [out] cos_x cosine of x
+      */
+    static void sin_cos(const T x, T &sin_x, T &cos_x) {
+        static constexpr auto cs = series<wide ? 8 : 4>(3, 2, true, true);
+        static constexpr auto cc = series<wide ? 8 : 5>(2, 2, true, true);
+        const T two_pi = wide ? 0x1.45f306dc9c883p-1 : 0x1.45f306p-1;
+        const T pi_2_1 = wide ? 0x1.921fb544p+0 : 0x1.922p+0;
+        const T pi_2_2 = wide ? 0x1.0b4611a6p-34 : -0x1.2aep-18;
+        const T pi_2_3 = wide ? 0x1.3198a2e037073p-69 : -0x1.de973ep-31;
+        // x = k pi/2 + r with |r| <= pi/4
+        I k;
+        const T kf = round(x * two_pi, k);
+        const T r = ((x - kf * pi_2_1) - kf * pi_2_2) - kf * pi_2_3;
+        const T z = r * r;
+        const T sin_r = r - (r * z) * horner(z, cs);
+        const T cos_r = T(1) - z * horner(z, cc);
+        // quadrant
+        const bool swap = (k & 1) != 0;
+        sin_x = select(swap, cos_r, sin_r);
+        cos_x = select(swap, sin_r, cos_r);
+        sin_x = select((k & 2) != 0, -sin_x, sin_x);
+        cos_x = select(((k + 1) & 2) != 0, -cos_x, cos_x);
+    }
+
+    /** \brief Angle of a point in the upper half-plane
+      * \param [in] y ordinate, y >= 0
+      * \param [in] x abscissa
+      * \return atan2(y, x) in [0, pi], 0 for x = -0
+      */
+    static T atan2(const T y, const T x) {
+        static constexpr auto c = series<wide ? 20 : 9>(3, 2, false, true);
+        const T tan_pi_8 = wide ? 0x1.a827999fcef32p-2 : 0x1.a8279ap-2;
+        const T pi_4_hi = wide ? 0x1.921fb54442d18p-1 : 0x1.921fb6p-1;
+        const T pi_4_lo = wide ? 0x1.1a62633145c07p-55 : -0x1.777a5cp-26;
+        const T pi_2_hi = wide ? 0x1.921fb54442d18p+0 : 0x1.921fb6p+0;
+        const T pi_2_lo = wide ? 0x1.1a62633145c07p-54 : -0x1.777a5cp-25;
+        const T pi_hi = wide ? 0x1.921fb54442d18p+1 : 0x1.921fb6p+1;
+        const T pi_lo = wide ? 0x1.1a62633145c07p-53 : -0x1.777a5cp-24;
+        // t = tan of the angle to the nearest axis, in [0, 1]
+        const T ax = select(x < T(0), -x, x);
+        const bool steep = y > ax;
+        const T num = select(steep, ax, y), den = select(steep, y, ax);
+        T t = num / den;
+        t = select(num == den, T(1), t);
+        t = select(den == T(0), T(0), t);
+        // atan(t) = pi/4 + atan(u) for t > tan(pi/8), |u| <= tan(pi/8)
+        const bool high = t > tan_pi_8;
+        const T u = select(high, (t - T(1)) / (t + T(1)), t);
+        const T z = u * u;
+        T a = u - (u * z) * horner(z, c);
+        a = select(high, pi_4_hi + (a + pi_4_lo), a);
+        a = select(steep, pi_2_hi - (a - pi_2_lo), a);
+        return select(x < T(0), pi_hi - (a - pi_lo), a);
+    }
+};
+
+/** Element-wise functions over the component lanes of up to
+  * HypercomplexArray<T, dim>::block numbers (see batch_exp())
+  *
+  * in[i] and out[i] point to the i-th components of n numbers;
+  * separate input and output lanes keep the loops vectorised.
+  */
+template <typename T, const unsigned int dim>
+struct BatchFunctions {
+    using VM = VectorMath<T>;
+    static constexpr std::size_t block = HypercomplexArray<T, dim>::block;
+
+    // squared norms of the imaginary parts
+    static void imaginary_norm2(
+        const T *const *in,
+        T *norm2,
+        const std::size_t n
+    ) {
+        for (std::size_t j=0; j < n; j++) norm2[j] = T();
+        for (unsigned int i=1; i < dim; i++) {
+            const T *a = in[i];
+            for (std::size_t j=0; j < n; j++) norm2[j] += a[j] * a[j];
+        }
+    }
+
+    // square roots; std::sqrt() is not vectorised while it sets errno
+    static void lane_sqrt(const T *x, T *y, const std::size_t n) {
+        std::size_t j = 0;
+#if defined(__SSE2__) && !defined(HYPERCOMPLEX_NO_SIMD)
+        using V = typename WidestVector<T>::type;
+        for (; j + V::width <= n; j += V::width)
+            V::store(y + j, V::sqrt(V::load(x + j)));
+#endif
+        for (; j < n; j++) y[j] = std::sqrt(x[j]);
+    }
+
+    // sine and cosine, beyond sin_cos_max through the standard library
+    static void sin_cos(const T *x, T *s, T *c, const std::size_t n) {
+        for (std::size_t j=0; j < n; j++) VM::sin_cos(x[j], s[j], c[j]);
+        for (std::size_t j=0; j < n; j++) {
+            if (!(std::abs(x[j]) <= VM::sin_cos_max)) {
+                s[j] = std::sin(x[j]);
+                c[j] = std::cos(x[j]);
+            }
+        }
+    }
+
+    // imaginary parts of out = scale Im(in) + first e_1;
+    // real numbers have no e_1, so results with first != 0 are NaN
+    static void scale_imaginary(
+        const T *const *in,
+        T *const *out,
+        const T *scale,
+        const T *first,
+        const std::size_t n
+    ) {
+        for (unsigned int i=1; i < dim; i++) {
+            const T *a = in[i];
+            T *b = out[i];
+            for (std::size_t j=0; j < n; j++) b[j] = a[j] * scale[j];
+        }
+        if constexpr (dim > 1) {
+            for (std::size_t j=0; j < n; j++) out[1][j] += first[j];
+        } else {
+            const T nan = std::numeric_limits<T>::quiet_NaN();
+            for (std::size_t j=0; j < n; j++)
+                out[0][j] = VM::select(first[j] != T(0), nan, out[0][j]);
+        }
+    }
+
+    // out = r (cos(phi) + u sin(phi)) with u the unit vector of Im(in),
+    // which is the first imaginary unit for real numbers; r of the j-th
+    // number is modulus(j, |Im|^2) and phi is angle(j, |Im|), so that
+    // every buffer is filled and read by loops over the same n entries
+    template <typename M, typename A>
+    static void polar(
+        const T *const *in,
+        T *const *out,
+        const std::size_t n,
+        const M &modulus,
+        const A &angle
+    ) {
+        T norm[block], r[block], phi[block], s[block], c[block];
+        imaginary_norm2(in, norm, n);
+        for (std::size_t j=0; j < n; j++) r[j] = modulus(j, norm[j]);
+        lane_sqrt(norm, norm, n);
+        for (std::size_t j=0; j < n; j++) phi[j] = angle(j, norm[j]);
+        sin_cos(phi, s, c, n);
+        // s and phi are reused for the scale and the first component
+        for (std::size_t j=0; j < n; j++) {
+            const T rs = r[j] * s[j];
+            const bool real = norm[j] == T(0);
+            s[j] = VM::select(real, T(0), rs / norm[j]);
+            phi[j] = VM::select(real, rs, T(0));
+            out[0][j] = r[j] * c[j];
+        }
+        scale_imaginary(in, out, s, phi, n);
+    }
+
+    // |Im(in)| and log|in|
+    static void log_norm(
+        const T *const *in,
+        T *norm,
+        T *log_r,
+        const std::size_t n
+    ) {
+        imaginary_norm2(in, norm, n);
+        for (std::size_t j=0; j < n; j++) {
+            const T a0 = in[0][j];
+            log_r[j] = VM::log(a0 * a0 + norm[j]) * T(0.5);
+        }
+        lane_sqrt(norm, norm, n);
+    }
+
+    static void exp(const T *const *in, T *const *out, const std::size_t n) {
+        // e^H = e^Re(H) (cos|Im(H)| + u sin|Im(H)|)
+        polar(in, out, n,
+            [in](std::size_t j, T) { return VM::exp(in[0][j]); },
+            [](std::size_t, T norm) { return norm; });
+    }
+
+    static void log(const T *const *in, T *const *out, const std::size_t n) {
+        T norm[block], scale[block], first[block];
+        log_norm(in, norm, out[0], n);
+        // log(H) = log|H| + u arg(H), arg(H) = atan2(|Im(H)|, Re(H))
+        for (std::size_t j=0; j < n; j++) {
+            const T phi = VM::atan2(norm[j], in[0][j]);
+            const bool real = norm[j] == T(0);
+            scale[j] = VM::select(real, T(0), phi / norm[j]);
+            first[j] = VM::select(real, phi, T(0));
+        }
+        scale_imaginary(in, out, scale, first, n);
+    }
+
+    static void sqrt(const T *const *in, T *const *out, const std::size_t n) {
+        T norm[block], w[block], scale[block], first[block];
+        imaginary_norm2(in, norm, n);
+        for (std::size_t j=0; j < n; j++) {
+            const T a0 = in[0][j];
+            w[j] = a0 * a0 + norm[j];
+        }
+        lane_sqrt(w, w, n);
+        // w = sqrt((|H| + |Re(H)|) / 2) has no cancellation; it is the
+        // real part for Re(H) >= 0 and the imaginary norm otherwise
+        for (std::size_t j=0; j < n; j++) {
+            const T a0 = in[0][j];
+            w[j] = (w[j] + VM::select(a0 < T(0), -a0, a0)) * T(0.5);
+        }
+        lane_sqrt(w, w, n);
+        lane_sqrt(norm, norm, n);
+        for (std::size_t j=0; j < n; j++) {
+            const bool negative = in[0][j] < T(0);
+            const bool zero = w[j] == T(0), real = norm[j] == T(0);
+            const T half_inv = T(0.5) / w[j];
+            const T re = VM::select(negative, norm[j] * half_inv, w[j]);
+            out[0][j] = VM::select(zero, T(0), re);
+            scale[j] = VM::select(negative, w[j] / norm[j], half_inv);
+            scale[j] = VM::select(zero || real, T(0), scale[j]);
+            first[j] = VM::select(negative && real, w[j], T(0));
+        }
+        scale_imaginary(in, out, scale, first, n);
+    }
+
+    // 0^p = 1 / 0^-p is a division by zero for p < 0, as in inv()
+    static void check_pow_base(
+        const T *const *in,
+        const T p,
+        const std::size_t n
+    ) {
+        if (!(p < T(0))) return;
+        for (std::size_t j=0; j < n; j++) {
+            bool is_zero = true;
+            for (unsigned int i=0; i < dim; i++)
+                is_zero = is_zero && in[i][j] == T(0);
+            if (is_zero) throw std::invalid_argument("division by zero");
+        }
+    }
+
+    static void pow(
+        const T *const *in,
+        const T p,
+        T *const *out,
+        const std::size_t n
+    ) {
+        check_pow_base(in, p, n);
+        // H^p = |H|^p (cos(p phi) + u sin(p phi)), phi = arg(H),
+        // with log|H| rounded as in log_norm()
+        polar(in, out, n,
+            [in, p](std::size_t j, T norm2) {
+                const T a0 = in[0][j];
+                return VM::exp(p * (VM::log(a0 * a0 + norm2) * T(0.5)));
+            },
+            [in, p](std::size_t j, T norm) {
+                return p * VM::atan2(norm, in[0][j]);
+            });
+        if (p == T(0)) {
+            // also for zero, infinite and NaN numbers
+            for (std::size_t j=0; j < n; j++) out[0][j] = T(1);
+            for (unsigned int i=1; i < dim; i++)
+                for (std::size_t j=0; j < n; j++) out[i][j] = T(0);
+        }
+    }
+
+    // run f over the lanes of an array, block by block
+    template <typename F>
+    static HypercomplexArray<T, dim> run(
+        const HypercomplexArray<T, dim> &A,
+        const F &f
+    ) {
+        HypercomplexArray<T, dim> B(A.size());
+        const T *in[dim];
+        T *out[dim];
+        for (std::size_t start=0; start < A.size(); start += block) {
+            const std::size_t len = std::min(block, A.size() - start);
+            for (unsigned int i=0; i < dim; i++) {
+                in[i] = A.lane(i) + start;
+                out[i] = B.lane(i) + start;
+            }
+            f(in, out, len);
+        }
+        return B;
+    }
+
+    // run f over arrays of numbers, transposed block by block
+    template <typename F>
+    static void run(
+        const Hypercomplex<T, dim> *H,
+        Hypercomplex<T, dim> *out,
+        const std::size_t n,
+        const F &f
+    ) {
+        if (!n) return;
+        // chunks of about 8 kB, so that the lanes stay in the L1 cache
+        const std::size_t chunk = std::min(
+            block, std::max<std::size_t>(8192 / (dim * sizeof(T)), 8));
+        const std::size_t stride = std::min(chunk, n);
+        std::vector<T> buffer(2 * dim * stride);
+        T *in[dim], *result[dim];
+        for (unsigned int i=0; i < dim; i++) {
+            in[i] = &buffer[i * stride];
+            result[i] = &buffer[(dim + i) * stride];
+        }
+        for (std::size_t start=0; start < n; start += chunk) {
+            const std::size_t len = std::min(chunk, n - start);
+            for (std::size_t j=0; j < len; j++) {
+                const T *h = &H[start + j][0];
+                for (unsigned int i=0; i < dim; i++) in[i][j] = h[i];
+            }
+            f(in, result, len);
+            for (std::size_t j=0; j < len; j++) {
+                T *h = &out[start + j][0];
+                for (unsigned int i=0; i < dim; i++) h[i] = result[i][j];
+            }
+        }
+    }
+};
+
+// calculate e^H for arrays of float or double numbers
+template <typename T, const unsigned int dim>
+void batch_exp(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+) {
+    BatchFunctions<T, dim>::run(H, out, n, BatchFunctions<T, dim>::exp);
+}
+
+// calculate log(H) for arrays of float or double numbers
+template <typename T, const unsigned int dim>
+void batch_log(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+) {
+    BatchFunctions<T, dim>::run(H, out, n, BatchFunctions<T, dim>::log);
+}
+
+// calculate square roots for arrays of float or double numbers
+template <typename T, const unsigned int dim>
+void batch_sqrt(
+    const Hypercomplex<T, dim> *H,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+) {
+    BatchFunctions<T, dim>::run(H, out, n, BatchFunctions<T, dim>::sqrt);
+}
+
+// calculate H^p for arrays of float or double numbers
+template <typename T, const unsigned int dim>
+void batch_pow(
+    const Hypercomplex<T, dim> *H,
+    const T p,
+    Hypercomplex<T, dim> *out,
+    const std::size_t n
+) {
+    // checked ahead, so that no result is written before the exception
+    for (std::size_t j=0; j < n; j++) {
+        const T *in[dim];
+        for (unsigned int i=0; i < dim; i++) in[i] = &H[j][i];
+        BatchFunctions<T, dim>::check_pow_base(in, p, 1);
+    }
+    BatchFunctions<T, dim>::run(H, out, n,
+        [p](const T *const *in, T *const *lanes, const std::size_t len) {
+            BatchFunctions<T, dim>::pow(in, p, lanes, len);
+        });
+}
+
+// calculate e^A for all elements with vectorised functions
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_exp(const HypercomplexArray<T, dim> &A) {
+    return BatchFunctions<T, dim>::run(A, BatchFunctions<T, dim>::exp);
+}
+
+// calculate log(A) for all elements with vectorised functions
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_log(const HypercomplexArray<T, dim> &A) {
+    return BatchFunctions<T, dim>::run(A, BatchFunctions<T, dim>::log);
+}
+
+// calculate square roots of all elements with vectorised functions
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_sqrt(const HypercomplexArray<T, dim> &A) {
+    return BatchFunctions<T, dim>::run(A, BatchFunctions<T, dim>::sqrt);
+}
+
+// calculate A^p for all elements with vectorised functions
+template <typename T, const unsigned int dim>
+HypercomplexArray<T, dim> batch_pow(
+    const HypercomplexArray<T, dim> &A,
+    const T p
+) {
+    return BatchFunctions<T, dim>::run(A,
+        [p](const T *const *in, T *const *out, const std::size_t len) {
+            BatchFunctions<T, dim>::pow(in, p, out, len);
+        });
+}
+
+/*
+###############################################################################
+#
+#   Double-double and quad-double base types
+#
+###############################################################################
+*/
+
+// The types share a namespace with their operators and elementary
+// functions, which argument-dependent lookup finds there; the helpers
+// are kept in a nested detail namespace. The type names are also
+// declared in the global namespace at the end of the section.
+namespace hypercomplex_extended {
+
+// error-free transformations and shared algorithms of the types below
+namespace detail {
+
+/** \brief Sum of two doubles with its rounding error
+  * \param [in] a first summand
+  * \param [in] b second summand
+  * \param [out] err rounding error, a + b = result + err exactly
+  * \return a + b rounded to nearest
+  */
+inline double two_sum(const double a, const double b, double &err) {
+    const double s = a + b;
+    const double v = s - a;
+    err = (a - (s - v)) + (b - v);
+    return s;
+}
+
+/** \brief Sum of two doubles with its rounding error, |a| >= |b|
+  * \param [in] a first summand, larger in magnitude (or zero)
+  * \param [in] b second summand
+  * \param [out] err rounding error, a + b = result + err exactly
+  * \return a + b rounded to nearest
+  */
+inline double quick_two_sum(const double a, const double b, double &err) {
+    const double s = a + b;
+    err = b - (s - a);
+    return s;
+}
+
+/** \brief Product of two doubles with its rounding error
+  * \param [in] a first factor
+  * \param [in] b second factor
+  * \param [out] err rounding error, a * b = result + err exactly
+  * \return a * b rounded to nearest
+  *
+  * Uses a fused multiply-add where it is done in hardware,
+  * Dekker's splitting of the factors otherwise (which requires
+  * the factors to be below 2^996 in magnitude).
+  */
+inline double two_prod(const double a, const double b, double &err) {
+    const double p = a * b;
+#if defined(FP_FAST_FMA)
+    err = std::fma(a, b, -p);
+#else
+    const double split = 134217729.0;  // 2^27 + 1
+    double t = split * a;
+    const double a_hi = t - (t - a);
+    const double a_lo = a - a_hi;
+    t = split * b;
+    const double b_hi = t - (t - b);
+    const double b_lo = b - b_hi;
+    err = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+#endif
+    return p;
+}
+
+}  // namespace detail
+
+/** Unevaluated sum of two doubles with about 106 bits of precision
+  *
+  * The value is hi + lo with |lo| at most half an ulp of hi.
+  * Operations are built from error-free transformations of double
+  * operations, so they run in hardware at a small multiple of the
+  * cost of double, with the exponent range of double.
+  * Special values (infinities, NaN) are not propagated reliably.
+  */
+class double_double {
+ public:
+    /** Leading component */
+    double hi;
+    /** Trailing component */
+    double lo;
+
+    /** Number of significant bits */
+    static constexpr unsigned int digits = 106;
+
+    /** \brief Zero, as for the built-in floating-point types
+      * \return new class instance
+      */
+    constexpr double_double() : hi(0.0), lo(0.0) {}
+
+    /** \brief Conversion from double
+      * \param [in] x value
+      * \return new class instance
+      */
+    constexpr double_double(const double x) : hi(x), lo(0.0) {}  // NOLINT
+
+    /** \brief Construction from components
+      * \param [in] h leading component
+      * \param [in] l trailing component, at most half an ulp of h
+      * \return new class instance
+      */
+    constexpr double_double(const double h, const double l) :
+        hi(h), lo(l) {}
+
+    /** \brief Conversion to double
+      * \return value rounded to double
+      */
+    explicit operator double() const { return hi; }
+
+    /** \brief Natural logarithm of 2
+      * \return constant to full precision
+      */
+    static constexpr double_double ln2() {
+        return double_double(0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56);
+    }
+
+    /** \brief Half of pi, split for argument reduction
+      * \return non-overlapping doubles, one more than the components
+      */
+    static constexpr std::array<double, 3> pi_2() {
+        return {0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54,
+                -0x1.f1976b7ed8fbcp-110};
+    }
+
+    /** \brief Relative rounding error of the arithmetic
+      * \return machine epsilon
+      */
+    static constexpr double epsilon() { return 0x1p-104; }
+
+    /** \brief Addition-Assignment operator
+      * \param [in] x summand
+      * \return Reference to the caller
+      */
+    double_double& operator+= (const double_double &x);
+
+    /** \brief Subtraction-Assignment operator
+      * \param [in] x subtrahend
+      * \return Reference to the caller
+      */
+    double_double& operator-= (const double_double &x);
+
+    /** \brief Multiplication-Assignment operator
+      * \param [in] x factor
+      * \return Reference to the caller
+      */
+    double_double& operator*= (const double_double &x);
+
+    /** \brief Division-Assignment operator
+      * \param [in] x divisor
+      * \return Reference to the caller
+      */
+    double_double& operator/= (const double_double &x);
+};
+
+/** Unevaluated sum of four doubles with about 212 bits of precision
+  *
+  * The value is x[0] + x[1] + x[2] + x[3], each component at most
+  * half an ulp of the previous one. Like double_double, operations
+  * are built from error-free transformations of double operations
+  * and have the exponent range of double.
+  * Special values (infinities, NaN) are not propagated reliably.
+  */
+class quad_double {
+ public:
+    /** Components, in decreasing magnitude */
+    double x[4];
+
+    /** Number of significant bits */
+    static constexpr unsigned int digits = 212;
+
+    /** \brief Zero, as for the built-in floating-point types
+      * \return new class instance
+      */
+    constexpr quad_double() : x{0.0, 0.0, 0.0, 0.0} {}
+
+    /** \brief Conversion from double
+      * \param [in] a value
+      * \return new class instance
+      */
+    constexpr quad_double(const double a) : x{a, 0.0, 0.0, 0.0} {}  // NOLINT
+
+    /** \brief Conversion from double_double
+      * \param [in] a value
+      * \return new class instance
+      */
+    constexpr quad_double(const double_double &a) :  // NOLINT
+        x{a.hi, a.lo, 0.0, 0.0} {}
+
+    /** \brief Construction from components
+      * \param [in] a0 leading component
+      * \param [in] a1 second component
+      * \param [in] a2 third component
+      * \param [in] a3 trailing component
+      * \return new class instance
+      */
+    constexpr quad_double(
+        const double a0,
+        const double a1,
+        const double a2,
+        const double a3
+    ) : x{a0, a1, a2, a3} {}
+
+    /** \brief Conversion to double
+      * \return value rounded to double
+      */
+    explicit operator double() const { return x[0]; }
+
+    /** \brief Natural logarithm of 2
+      * \return constant to full precision
+      */
+    static constexpr quad_double ln2() {
+        return quad_double(0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56,
+                           0x1.7b57a079a1934p-111, -0x1.ace93a4ebe5d1p-165);
+    }
+
+    /** \brief Half of pi, split for argument reduction
+      * \return non-overlapping doubles, one more than the components
+      */
+    static constexpr std::array<double, 5> pi_2() {
+        return {0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54,
+                -0x1.f1976b7ed8fbcp-110, 0x1.4cf98e804177dp-164,
+                0x1.31d89cd9128a5p-218};
+    }
+
+    /** \brief Relative rounding error of the arithmetic
+      * \return machine epsilon
+      */
+    static constexpr double epsilon() { return 0x1p-209; }
+
+    /** \brief Addition-Assignment operator
+      * \param [in] a summand
+      * \return Reference to the caller
+      */
+    quad_double& operator+= (const quad_double &a);
+
+    /** \brief Subtraction-Assignment operator
+      * \param [in] a subtrahend
+      * \return Reference to the caller
+      */
+    quad_double& operator-= (const quad_double &a);
+
+    /** \brief Multiplication-Assignment operator
+      * \param [in] a factor
+      * \return Reference to the caller
+      */
+    quad_double& operator*= (const quad_double &a);
+
+    /** \brief Division-Assignment operator
+      * \param [in] a divisor
+      * \return Reference to the caller
+      */
+    quad_double& operator/= (const quad_double &a);
+};
+
+// overloaded + binary operator, accurate also under cancellation
+inline double_double operator+(
+    const double_double &a,
+    const double_double &b
+) {
+    double e, f;
+    double s = detail::two_sum(a.hi, b.hi, e);
+    const double t = detail::two_sum(a.lo, b.lo, f);
+    e += t;
+    s = detail::quick_two_sum(s, e, e);
+    e += f;
+    s = detail::quick_two_sum(s, e, e);
+    return double_double(s, e);
+}
+
+// overloaded unary - operator
+inline double_double operator-(const double_double &a) {
+    return double_double(-a.hi, -a.lo);
+}
+
+// overloaded - binary operator
+inline double_double operator-(
+    const double_double &a,
+    const double_double &b
+) {
+    return a + (-b);
+}
+
+// overloaded * binary operator
+inline double_double operator*(
+    const double_double &a,
+    const double_double &b
+) {
+    double e;
+    const double p = detail::two_prod(a.hi, b.hi, e);
+    e += a.hi * b.lo + a.lo * b.hi;
+    const double s = detail::quick_two_sum(p, e, e);
+    return double_double(s, e);
+}
+
+// overloaded * binary operator with a double factor
+inline double_double operator*(const double_double &a, const double b) {
+    double e;
+    const double p = detail::two_prod(a.hi, b, e);
+    e += a.lo * b;
+    const double s = detail::quick_two_sum(p, e, e);
+    return double_double(s, e);
+}
+
+// overloaded * binary operator with a double factor
+inline double_double operator*(const double a, const double_double &b) {
+    return b * a;
+}
+
+// overloaded / binary operator
+inline double_double operator/(
+    const double_double &a,
+    const double_double &b
+) {
+    // long division, one double of the quotient at a time
+    const double q1 = a.hi / b.hi;
+    double_double r = a - b * q1;
+    const double q2 = r.hi / b.hi;
+    r = r - b * q2;
+    const double q3 = r.hi / b.hi;
+    double e;
+    const double q = detail::quick_two_sum(q1, q2, e);
+    return double_double(q, e) + q3;
+}
+
+// overloaded / binary operator with a double divisor
+inline double_double operator/(const double_double &a, const double b) {
+    const double q1 = a.hi / b;
+    double p2, e;
+    const double p1 = detail::two_prod(q1, b, p2);
+    const double s = detail::two_sum(a.hi, -p1, e);
+    e += a.lo - p2;
+    const double q2 = (s + e) / b;
+    const double q = detail::quick_two_sum(q1, q2, e);
+    return double_double(q, e);
+}
+
+inline double_double& double_double::operator+=(const double_double &x) {
+    return *this = *this + x;
+}
+
+inline double_double& double_double::operator-=(const double_double &x) {
+    return *this = *this - x;
+}
+
+inline double_double& double_double::operator*=(const double_double &x) {
+    return *this = *this * x;
+}
+
+inline double_double& double_double::operator/=(const double_double &x) {
+    return *this = *this / x;
+}
+
+// overloaded comparison operators
+inline bool operator==(const double_double &a, const double_double &b) {
+    return a.hi == b.hi && a.lo == b.lo;
+}
+
+inline bool operator!=(const double_double &a, const double_double &b) {
+    return !(a == b);
+}
+
+inline bool operator<(const double_double &a, const double_double &b) {
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+inline bool operator>(const double_double &a, const double_double &b) {
+    return b < a;
+}
+
+inline bool operator<=(const double_double &a, const double_double &b) {
+    return !(b < a);
+}
+
+inline bool operator>=(const double_double &a, const double_double &b) {
+    return !(a < b);
+}
+
+// multiply by 2^n, exactly unless the result underflows
+inline double_double ldexp(const double_double &a, const int n) {
+    return double_double(std::ldexp(a.hi, n), std::ldexp(a.lo, n));
+}
+
+// absolute value
+inline double_double abs(const double_double &a) {
+    return a.hi < 0.0 ? -a : a;
+}
+
+// sign bit, also of signed zeros
+inline bool signbit(const double_double &a) {
+    return std::signbit(a.hi);
+}
+
+namespace detail {
+
+// sum of three doubles in place: a + b + c = a' + b' + c' exactly,
+// with a' the rounded sum
+inline void three_sum(double &a, double &b, double &c) {
+    double t2, t3;
+    const double t1 = detail::two_sum(a, b, t2);
+    a = detail::two_sum(c, t1, t3);
+    b = detail::two_sum(t2, t3, c);
+}
+
+// sum of three doubles in place, the error of the sum of the
+// last two terms is dropped
+inline void three_sum2(double &a, double &b, double &c) {
+    double t2, t3;
+    const double t1 = detail::two_sum(a, b, t2);
+    a = detail::two_sum(c, t1, t3);
+    b = t2 + t3;
+}
+
+// accumulate c into the two-term sum (a, b); returns the leading
+// double once it can no longer change, zero otherwise
+inline double quick_three_accum(double &a, double &b, const double c) {
+    double s = detail::two_sum(b, c, b);
+    s = detail::two_sum(a, s, a);
+    const bool za = a != 0.0;
+    const bool zb = b != 0.0;
+    if (za && zb) return s;
+    if (!zb) {
+        b = a;
+        a = s;
     } else {
-        T sinv_v = sin(norm) / norm;
-        for (unsigned int i=0; i < dim; i++) result[i] = result[i] * sinv_v;
-        result[0] = result[0] + cos(norm);
-        for (unsigned int i=0; i < dim; i++) result[i] = result[i] * exp(H[0]);
+        a = s;
     }
-    return result;
+    return 0.0;
+}
+
+// turn five overlapping doubles into four non-overlapping ones
+inline quad_double quad_double_renormalize(
+    double c0,
+    double c1,
+    double c2,
+    double c3,
+    double c4
+) {
+    if (std::isinf(c0)) return quad_double(c0, c1, c2, c3);
+    double s0 = detail::quick_two_sum(c3, c4, c4);
+    s0 = detail::quick_two_sum(c2, s0, c3);
+    s0 = detail::quick_two_sum(c1, s0, c2);
+    c0 = detail::quick_two_sum(c0, s0, c1);
+    double s1 = c1, s2 = 0.0, s3 = 0.0;
+    s0 = c0;
+    if (s1 != 0.0) {
+        s1 = detail::quick_two_sum(s1, c2, s2);
+        if (s2 != 0.0) {
+            s2 = detail::quick_two_sum(s2, c3, s3);
+            if (s3 != 0.0)
+                s3 += c4;
+            else
+                s2 = detail::quick_two_sum(s2, c4, s3);
+        } else {
+            s1 = detail::quick_two_sum(s1, c3, s2);
+            if (s2 != 0.0)
+                s2 = detail::quick_two_sum(s2, c4, s3);
+            else
+                s1 = detail::quick_two_sum(s1, c4, s2);
+        }
+    } else {
+        s0 = detail::quick_two_sum(s0, c2, s1);
+        if (s1 != 0.0) {
+            s1 = detail::quick_two_sum(s1, c3, s2);
+            if (s2 != 0.0)
+                s2 = detail::quick_two_sum(s2, c4, s3);
+            else
+                s1 = detail::quick_two_sum(s1, c4, s2);
+        } else {
+            s0 = detail::quick_two_sum(s0, c3, s1);
+            if (s1 != 0.0)
+                s1 = detail::quick_two_sum(s1, c4, s2);
+            else
+                s0 = detail::quick_two_sum(s0, c4, s1);
+        }
+    }
+    return quad_double(s0, s1, s2, s3);
+}
+
+// sum of two quad_double numbers whose leading components cancel:
+// the components are merged by decreasing magnitude and accumulated
+inline quad_double quad_double_cancelling_sum(
+    const quad_double &a,
+    const quad_double &b
+) {
+    unsigned int i = 0, j = 0, k = 0;
+    double u, v, x[4] = {0.0, 0.0, 0.0, 0.0};
+    auto next = [&]() {
+        if (i >= 4) return b.x[j++];
+        if (j >= 4) return a.x[i++];
+        if (std::fabs(a.x[i]) > std::fabs(b.x[j])) return a.x[i++];
+        return b.x[j++];
+    };
+    u = next();
+    v = next();
+    u = detail::quick_two_sum(u, v, v);
+    while (k < 4) {
+        if (i >= 4 && j >= 4) {
+            x[k] = u;
+            if (k < 3) x[++k] = v;
+            break;
+        }
+        const double s = detail::quick_three_accum(u, v, next());
+        if (s != 0.0) x[k++] = s;
+    }
+    for (unsigned int m=i; m < 4; m++) x[3] += a.x[m];
+    for (unsigned int m=j; m < 4; m++) x[3] += b.x[m];
+    return detail::quad_double_renormalize(x[0], x[1], x[2], x[3], 0.0);
+}
+
+// sum of two quad_double numbers accurate to a few ulps of |a| + |b|
+inline quad_double quad_double_sum(const quad_double &a, const quad_double &b) {
+    double t0, t1, t2, t3;
+    const double s0 = detail::two_sum(a.x[0], b.x[0], t0);
+    double s1 = detail::two_sum(a.x[1], b.x[1], t1);
+    double s2 = detail::two_sum(a.x[2], b.x[2], t2);
+    double s3 = detail::two_sum(a.x[3], b.x[3], t3);
+    s1 = detail::two_sum(s1, t0, t0);
+    detail::three_sum(s2, t0, t1);
+    detail::three_sum2(s3, t0, t2);
+    t0 = t0 + t1 + t3;
+    return detail::quad_double_renormalize(s0, s1, s2, s3, t0);
+}
+
+}  // namespace detail
+
+// overloaded + binary operator, accurate also under cancellation
+inline quad_double operator+(const quad_double &a, const quad_double &b) {
+    // the componentwise sum is enough unless the leading components cancel
+    if (std::fabs(a.x[0] + b.x[0]) <
+        0.5 * std::max(std::fabs(a.x[0]), std::fabs(b.x[0])))
+        return detail::quad_double_cancelling_sum(a, b);
+    return detail::quad_double_sum(a, b);
+}
+
+// overloaded unary - operator
+inline quad_double operator-(const quad_double &a) {
+    return quad_double(-a.x[0], -a.x[1], -a.x[2], -a.x[3]);
+}
+
+// overloaded - binary operator
+inline quad_double operator-(const quad_double &a, const quad_double &b) {
+    return a + (-b);
+}
+
+// overloaded * binary operator, terms below eps^3 are summed
+// without their rounding errors
+inline quad_double operator*(const quad_double &a, const quad_double &b) {
+    double q0, q1, q2, q3, q4, q5, t0, t1;
+    double p0 = detail::two_prod(a.x[0], b.x[0], q0);
+    double p1 = detail::two_prod(a.x[0], b.x[1], q1);
+    double p2 = detail::two_prod(a.x[1], b.x[0], q2);
+    double p3 = detail::two_prod(a.x[0], b.x[2], q3);
+    double p4 = detail::two_prod(a.x[1], b.x[1], q4);
+    double p5 = detail::two_prod(a.x[2], b.x[0], q5);
+    detail::three_sum(p1, p2, q0);
+    detail::three_sum(p2, q1, q2);
+    detail::three_sum(p3, p4, p5);
+    // (s0, s1, s2) = (p2, q1, q2) + (p3, p4, p5)
+    const double s0 = detail::two_sum(p2, p3, t0);
+    double s1 = detail::two_sum(q1, p4, t1);
+    double s2 = q2 + p5;
+    s1 = detail::two_sum(s1, t0, t0);
+    s2 += t0 + t1;
+    s1 += a.x[0] * b.x[3] + a.x[1] * b.x[2] + a.x[2] * b.x[1] +
+        a.x[3] * b.x[0] + q0 + q3 + q4 + q5;
+    return detail::quad_double_renormalize(p0, p1, s0, s1, s2);
+}
+
+// overloaded * binary operator with a double factor
+inline quad_double operator*(const quad_double &a, const double b) {
+    double q0, q1, q2, s2;
+    const double p0 = detail::two_prod(a.x[0], b, q0);
+    double p1 = detail::two_prod(a.x[1], b, q1);
+    double p2 = detail::two_prod(a.x[2], b, q2);
+    double p3 = a.x[3] * b;
+    const double s1 = detail::two_sum(q0, p1, s2);
+    detail::three_sum(s2, q1, p2);
+    detail::three_sum2(q1, q2, p3);
+    return detail::quad_double_renormalize(p0, s1, s2, q1, q2 + p2);
+}
+
+// overloaded * binary operator with a double factor
+inline quad_double operator*(const double a, const quad_double &b) {
+    return b * a;
+}
+
+// overloaded / binary operator
+inline quad_double operator/(const quad_double &a, const quad_double &b) {
+    // long division, one double of the quotient at a time; the
+    // remainders only need to be accurate relative to a
+    double q[5];
+    quad_double r = a;
+    for (unsigned int i=0; i < 4; i++) {
+        q[i] = r.x[0] / b.x[0];
+        r = detail::quad_double_sum(r, -(b * q[i]));
+    }
+    q[4] = r.x[0] / b.x[0];
+    return detail::quad_double_renormalize(q[0], q[1], q[2], q[3], q[4]);
+}
+
+// overloaded / binary operator with a double divisor
+inline quad_double operator/(const quad_double &a, const double b) {
+    // long division, one double of the quotient at a time; the
+    // remainders only need to be accurate relative to a
+    double q[5], p, e;
+    quad_double r = a;
+    for (unsigned int i=0; i < 4; i++) {
+        q[i] = r.x[0] / b;
+        p = detail::two_prod(q[i], b, e);
+        r = detail::quad_double_sum(r, quad_double(-p, -e, 0.0, 0.0));
+    }
+    q[4] = r.x[0] / b;
+    return detail::quad_double_renormalize(q[0], q[1], q[2], q[3], q[4]);
+}
+
+inline quad_double& quad_double::operator+=(const quad_double &a) {
+    return *this = *this + a;
+}
+
+inline quad_double& quad_double::operator-=(const quad_double &a) {
+    return *this = *this - a;
+}
+
+inline quad_double& quad_double::operator*=(const quad_double &a) {
+    return *this = *this * a;
+}
+
+inline quad_double& quad_double::operator/=(const quad_double &a) {
+    return *this = *this / a;
+}
+
+// overloaded comparison operators
+inline bool operator==(const quad_double &a, const quad_double &b) {
+    return a.x[0] == b.x[0] && a.x[1] == b.x[1] &&
+        a.x[2] == b.x[2] && a.x[3] == b.x[3];
+}
+
+inline bool operator!=(const quad_double &a, const quad_double &b) {
+    return !(a == b);
+}
+
+inline bool operator<(const quad_double &a, const quad_double &b) {
+    for (unsigned int i=0; i < 4; i++) {
+        if (a.x[i] != b.x[i]) return a.x[i] < b.x[i];
+    }
+    return false;
+}
+
+inline bool operator>(const quad_double &a, const quad_double &b) {
+    return b < a;
+}
+
+inline bool operator<=(const quad_double &a, const quad_double &b) {
+    return !(b < a);
+}
+
+inline bool operator>=(const quad_double &a, const quad_double &b) {
+    return !(a < b);
+}
+
+// multiply by 2^n, exactly unless the result underflows
+inline quad_double ldexp(const quad_double &a, const int n) {
+    return quad_double(std::ldexp(a.x[0], n), std::ldexp(a.x[1], n),
+                       std::ldexp(a.x[2], n), std::ldexp(a.x[3], n));
+}
+
+// absolute value
+inline quad_double abs(const quad_double &a) {
+    return a.x[0] < 0.0 ? -a : a;
+}
+
+// sign bit, also of signed zeros
+inline bool signbit(const quad_double &a) {
+    return std::signbit(a.x[0]);
+}
+
+namespace detail {
+
+/** \brief Square root of a double_double or quad_double
+  * \param [in] a non-negative operand
+  * \return square root, NaN for negative operands
+  *
+  * Newton iteration on 1/sqrt(a), starting from the double result,
+  * and a last correction of a/sqrt(a) that doubles its precision.
+  */
+template <typename T>
+T expansion_sqrt(const T &a) {
+    const double a0 = static_cast<double>(a);
+    if (a0 == 0.0) return T();
+    if (a0 < 0.0) return T(std::numeric_limits<double>::quiet_NaN());
+    T r = 1.0 / std::sqrt(a0);
+    const T h = ldexp(a, -1);
+    for (unsigned int bits=53; 2 * bits < T::digits; bits *= 2)
+        r += (0.5 - h * (r * r)) * r;
+    const T y = a * r;
+    return y + (a - y * y) * ldexp(r, -1);
+}
+
+/** \brief Table of 1/n! in the precision of T
+  * \return array of 64 coefficients, computed on first use
+  */
+template <typename T>
+const T* expansion_inverse_factorials() {
+    static const std::array<T, 64> table = []() {
+        std::array<T, 64> inverse;
+        inverse[0] = 1.0;
+        for (unsigned int n=1; n < 64; n++)
+            inverse[n] = inverse[n - 1] / static_cast<double>(n);
+        return inverse;
+    }();
+    return table.data();
+}
+
+/** \brief Exponential of a double_double or quad_double
+  * \param [in] a operand
+  * \return e^a
+  *
+  * e^a = 2^k e^r with |r| <= ln(2)/2, where e^r - 1 is evaluated
+  * as a Taylor polynomial at r/2^10 and squared back up with
+  * (1 + s)^2 - 1 = s (s + 2), which keeps its relative precision.
+  */
+template <typename T>
+T expansion_exp(const T &a) {
+    const double a0 = static_cast<double>(a);
+    if (std::isnan(a0)) return T(a0);
+    if (a0 > 709.79) return T(std::numeric_limits<double>::infinity());
+    if (a0 < -745.2) return T();
+    const int squarings = 10;
+    const T* inverse = detail::expansion_inverse_factorials<T>();
+    const double k = std::nearbyint(a0 / static_cast<double>(T::ln2()));
+    const T r = ldexp(a - T::ln2() * k, -squarings);
+    // degree n of the polynomial: the next term is negligible
+    const double r0 = std::fabs(static_cast<double>(r));
+    unsigned int n = 1;
+    for (double power = r0 * r0; n < 62 && power *
+         static_cast<double>(inverse[n + 1]) > T::epsilon() * r0; n++)
+        power *= r0;
+    T s = inverse[n];
+    for (unsigned int i=n-1; i > 0; i--) s = s * r + inverse[i];
+    s = s * r;
+    for (int i=0; i < squarings; i++) s = s * (s + 2.0);
+    return ldexp(s + 1.0, static_cast<int>(k));
+}
+
+/** \brief Sine and cosine of a double_double or quad_double
+  * \param [in] a operand
+  * \param [out] sin_a sine of a
+  * \param [out] cos_a cosine of a
+  *
+  * a = k pi/2 + r with |r| <= pi/4, where the products of k with
+  * the parts of pi/2 are exact and pi/2 has one more double than T,
+  * so r keeps its relative precision near multiples of pi/2 unless
+  * k is large. sin(r) is evaluated as a Taylor polynomial and
+  * cos(r) = sqrt(1 - sin(r)^2) >= sqrt(1/2).
+  */
+template <typename T>
+void expansion_sin_cos(const T &a, T &sin_a, T &cos_a) {
+    const double a0 = static_cast<double>(a);
+    if (!std::isfinite(a0)) {
+        sin_a = cos_a = T(std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+    const T* inverse = detail::expansion_inverse_factorials<T>();
+    const double k = std::nearbyint(a0 / T::pi_2()[0]);
+    T r = a;
+    for (const double part : T::pi_2()) r -= T(part) * k;
+    // odd degree n of the polynomial: the next term is negligible
+    const double r0 = std::fabs(static_cast<double>(r));
+    unsigned int n = 1;
+    for (double power = r0 * r0; n < 61 && power *
+         static_cast<double>(inverse[n + 2]) > T::epsilon(); n += 2)
+        power *= r0 * r0;
+    // sin(r) / r = sum of (-1)^j r^2j / (2j + 1)!, with n = 2j + 1
+    const T r2 = r * r;
+    T s = (n & 2) ? -inverse[n] : inverse[n];
+    for (unsigned int i=n-2; i < n; i -= 2)
+        s = s * r2 + ((i & 2) ? -inverse[i] : inverse[i]);
+    s = s * r;
+    const T c = detail::expansion_sqrt(1.0 - s * s);
+    int quadrant = static_cast<int>(std::fmod(k, 4.0));
+    if (quadrant < 0) quadrant += 4;
+    switch (quadrant) {
+        case 0: sin_a = s; cos_a = c; break;
+        case 1: sin_a = c; cos_a = -s; break;
+        case 2: sin_a = -s; cos_a = -c; break;
+        default: sin_a = -c; cos_a = s; break;
+    }
+}
+
+/** \brief Natural logarithm of a double_double or quad_double
+  * \param [in] a operand
+  * \return log(a), NaN for negative operands
+  *
+  * Newton iteration x += a e^-x - 1 from the double result, each step
+  * doubling the number of correct bits. The error is a few units of
+  * T::epsilon() absolute, which is relative unless a is close to 1.
+  */
+template <typename T>
+T expansion_log(const T &a) {
+    const double a0 = static_cast<double>(a);
+    if (!(a0 > 0.0) || std::isinf(a0)) return T(std::log(a0));
+    T x = std::log(a0);
+    for (unsigned int bits=53; bits < T::digits; bits *= 2)
+        x += a * detail::expansion_exp(-x) - 1.0;
+    return x;
+}
+
+/** \brief Angle of a point (x, y) in double_double or quad_double
+  * \param [in] y ordinate
+  * \param [in] x abscissa
+  * \return angle in [-pi, pi]
+  *
+  * Newton iteration on sin(z) = y/r or cos(z) = x/r, whichever is
+  * better conditioned, from the double result. Zero and non-finite
+  * operands give the double result.
+  */
+template <typename T>
+T expansion_atan2(const T &y, const T &x) {
+    const double y0 = static_cast<double>(y), x0 = static_cast<double>(x);
+    T z = std::atan2(y0, x0);
+    if ((y0 == 0.0 && x0 == 0.0) || !std::isfinite(y0) || !std::isfinite(x0))
+        return z;
+    // exact scaling keeps the squares in range
+    const int e = -std::ilogb(std::max(std::fabs(y0), std::fabs(x0)));
+    const T ys = ldexp(y, e), xs = ldexp(x, e);
+    const T r = detail::expansion_sqrt(ys * ys + xs * xs);
+    const T ry = ys / r, rx = xs / r;
+    for (unsigned int bits=53; bits < T::digits; bits *= 2) {
+        T sin_z, cos_z;
+        detail::expansion_sin_cos(z, sin_z, cos_z);
+        if (std::fabs(x0) > std::fabs(y0)) z += (ry - sin_z) / cos_z;
+        else z -= (rx - cos_z) / sin_z;
+    }
+    return z;
+}
+
+/** \brief Write a double_double or quad_double in decimal
+  * \param [in,out] os output stream
+  * \param [in] a value
+  * \return output stream
+  *
+  * Scientific notation with os.precision() significant digits,
+  * generated one digit at a time in the precision of T.
+  */
+template <typename T>
+std::ostream& expansion_write(std::ostream &os, const T &a) {
+    const double a0 = static_cast<double>(a);
+    if (!std::isfinite(a0) || a0 == 0.0) return os << a0;
+    const int digits = std::max(1, static_cast<int>(os.precision()));
+    T r = abs(a);
+    int e = static_cast<int>(std::floor(std::log10(std::fabs(a0))));
+    // r = |a| / 10^e, the power by squaring
+    T power = 1.0, base = 10.0;
+    for (unsigned int n = std::abs(e); n; n >>= 1) {
+        if (n & 1) power *= base;
+        base *= base;
+    }
+    r = e < 0 ? r * power : r / power;
+    if (r < T(1.0)) {
+        r *= 10.0;
+        e--;
+    } else if (r >= T(10.0)) {
+        r /= 10.0;
+        e++;
+    }
+    std::vector<int> d(digits + 1);
+    for (int i=0; i <= digits; i++) {
+        d[i] = static_cast<int>(std::floor(static_cast<double>(r)));
+        if (r < T(d[i])) d[i]--;
+        d[i] = std::min(std::max(d[i], 0), 9);
+        r = (r - T(d[i])) * 10.0;
+    }
+    // round half up on the first dropped digit
+    if (d[digits] >= 5) {
+        int i = digits - 1;
+        for (; i >= 0 && ++d[i] == 10; i--) d[i] = 0;
+        if (i < 0) {
+            d[0] = 1;
+            e++;
+        }
+    }
+    std::string s = a0 < 0.0 ? "-" : "";
+    s += static_cast<char>('0' + d[0]);
+    if (digits > 1) s += '.';
+    for (int i=1; i < digits; i++) s += static_cast<char>('0' + d[i]);
+    s += e < 0 ? "e-" : "e+";
+    if (std::abs(e) < 10) s += '0';
+    s += std::to_string(std::abs(e));
+    return os << s;
+}
+
+}  // namespace detail
+
+// overloaded elementary functions, found by the templates of the main
+// class through argument-dependent lookup
+inline double_double sqrt(const double_double &a) {
+    return detail::expansion_sqrt(a);
+}
+
+inline double_double exp(const double_double &a) {
+    return detail::expansion_exp(a);
+}
+
+inline double_double log(const double_double &a) {
+    return detail::expansion_log(a);
+}
+
+inline double_double atan2(const double_double &y, const double_double &x) {
+    return detail::expansion_atan2(y, x);
+}
+
+inline double_double sin(const double_double &a) {
+    double_double s, c;
+    detail::expansion_sin_cos(a, s, c);
+    return s;
+}
+
+inline double_double cos(const double_double &a) {
+    double_double s, c;
+    detail::expansion_sin_cos(a, s, c);
+    return c;
+}
+
+inline void sin_cos(
+    const double_double &a,
+    double_double &s,
+    double_double &c
+) {
+    detail::expansion_sin_cos(a, s, c);
 }
 
+inline std::ostream& operator<<(std::ostream &os, const double_double &a) {
+    return detail::expansion_write(os, a);
+}
+
+inline quad_double sqrt(const quad_double &a) {
+    return detail::expansion_sqrt(a);
+}
+
+inline quad_double exp(const quad_double &a) {
+    return detail::expansion_exp(a);
+}
+
+inline quad_double log(const quad_double &a) {
+    return detail::expansion_log(a);
+}
+
+inline quad_double atan2(const quad_double &y, const quad_double &x) {
+    return detail::expansion_atan2(y, x);
+}
+
+inline quad_double sin(const quad_double &a) {
+    quad_double s, c;
+    detail::expansion_sin_cos(a, s, c);
+    return s;
+}
+
+inline quad_double cos(const quad_double &a) {
+    quad_double s, c;
+    detail::expansion_sin_cos(a, s, c);
+    return c;
+}
+
+inline void sin_cos(const quad_double &a, quad_double &s, quad_double &c) {
+    detail::expansion_sin_cos(a, s, c);
+}
+
+inline std::ostream& operator<<(std::ostream &os, const quad_double &a) {
+    return detail::expansion_write(os, a);
+}
+
+}  // namespace hypercomplex_extended
+
+using hypercomplex_extended::double_double;
+using hypercomplex_extended::quad_double;
+
 /*
 ###############################################################################
 #
@@ -582,27 +4546,510 @@ Hypercomplex<T, dim> exp(const Hypercomplex<T, dim> &H) {
 ###############################################################################
 */
 
-static unsigned int MPFR_global_precision;
+// default precision of all threads, shared by all translation units
+inline std::atomic<unsigned int> MPFR_global_precision(0);
+
+/** Precision of the MPFR variables for the calling thread
+  *
+  * While an instance lives, numbers created on the calling thread
+  * (including copies and results of operations) get its precision
+  * instead of the global one. Scopes nest, the previous precision
+  * is restored on destruction. Other threads are not affected,
+  * so pipeline stages may run concurrently at different precisions;
+  * the batch operations pass the precision on to their workers.
+  */
+class MPFRPrecisionScope {
+ public:
+    /** \brief Set the precision of the calling thread
+      * \param [in] n precision in bits
+      */
+    explicit MPFRPrecisionScope(const unsigned int n) :
+        previous(thread_precision()) {
+        thread_precision() = n;
+    }
+
+    MPFRPrecisionScope(const MPFRPrecisionScope &) = delete;
+    MPFRPrecisionScope& operator=(const MPFRPrecisionScope &) = delete;
+
+    ~MPFRPrecisionScope() { thread_precision() = previous; }
+
+    /** \brief Precision of the calling thread, 0 if not set
+      * \return reference to the thread-local precision in bits
+      */
+    static unsigned int& thread_precision() {
+        static thread_local unsigned int n = 0;
+        return n;
+    }
+
+ private:
+    unsigned int previous;
+};
 
-/** \brief Getter for the global precision of the MPFR variables
-  * \return precision in bits
+/** \brief Getter for the precision of the MPFR variables
+  * \return precision in bits on the calling thread
+  *
+  * This is the precision of the innermost MPFRPrecisionScope
+  * of the calling thread if there is one, the global one otherwise.
   */
-unsigned int get_mpfr_precision() {
-    return MPFR_global_precision;
+inline unsigned int get_mpfr_precision() {
+    const unsigned int n = MPFRPrecisionScope::thread_precision();
+    return n ? n : MPFR_global_precision.load();
 }
 
 /** \brief Setter for the global precision of the MPFR variables
   * \param [in] n precision in bits
+  *
+  * Applies to all threads outside of an MPFRPrecisionScope.
   */
-void set_mpfr_precision(unsigned int n) {
+inline void set_mpfr_precision(unsigned int n) {
     MPFR_global_precision = n;
 }
 
-/** \brief Wrapper for MPFR memory cleanup
+inline std::atomic<bool> MPFR_rounded_multiplication(false);
+
+/** \brief Setter for the multiplication mode of the MPFR numbers
+  * \param [in] enabled true for correctly rounded products
+  *
+  * By default every leaf product and partial sum of a product
+  * is rounded. When enabled, the leaf products are computed exactly
+  * and each component is rounded once (see
+  * cayley_dickson_rounded_multiply()). Applies to all threads.
+  */
+inline void set_mpfr_rounded_multiplication(bool enabled) {
+    MPFR_rounded_multiplication = enabled;
+}
+
+/** \brief Getter for the multiplication mode of the MPFR numbers
+  * \return true if products are correctly rounded
+  */
+inline bool get_mpfr_rounded_multiplication() {
+    return MPFR_rounded_multiplication.load();
+}
+
+#ifndef HYPERCOMPLEX_MPFR_REDUCED_PRECISION
+#define HYPERCOMPLEX_MPFR_REDUCED_PRECISION 0
+#endif
+
+/** Product algorithm of the MPFR numbers
+  *
+  * The reduced algorithm (see cayley_dickson_reduced_multiply())
+  * pays off once a multiplication costs several additions, from about
+  * two thousand bits on, but its errors are bounded relative to the
+  * largest components only, so it is off by default. Define
+  * HYPERCOMPLEX_MPFR_REDUCED_PRECISION to a number of bits (e.g. 2048)
+  * before including this header to use it for products computed at
+  * that precision or more, unless correctly rounded products are
+  * requested.
+  */
+template <>
+struct ReducedMultiplication<mpfr_t> :
+    std::integral_constant<bool, (HYPERCOMPLEX_MPFR_REDUCED_PRECISION > 0)> {
+    static constexpr mpfr_prec_t min_precision =
+        HYPERCOMPLEX_MPFR_REDUCED_PRECISION;
+};
+
+/** \brief Whether products at a given precision use the reduced algorithm
+  * \param [in] precision precision of the product in bits
+  * \return true if mpfr_multiply() takes the reduced kernel
+  */
+inline bool is_mpfr_multiplication_reduced(const mpfr_prec_t precision) {
+    return ReducedMultiplication<mpfr_t>::value &&
+        precision >= ReducedMultiplication<mpfr_t>::min_precision &&
+        !get_mpfr_rounded_multiplication();
+}
+
+/** Thread-local pool of initialised MPFR variables
+  *
+  * Hypercomplex<mpfr_t, dim> numbers and the temporaries of the MPFR
+  * operations take their arrays of variables from here and give them
+  * back when they are done, so loops over numbers of a fixed size
+  * stop calling mpfr_init2 and mpfr_clear after the first iteration.
+  * Arrays are kept per size and precision, at most capacity of each.
+  * An array may be released on a different thread than the one that
+  * acquired it, it then joins the pool of the releasing thread.
+  */
+class MPFRPool {
+ public:
+    static const std::size_t capacity = 64;
+
+    /** \brief Take an array of MPFR variables from the pool
+      * \param [in] n number of variables
+      * \return array of n variables at the current precision
+      *
+      * Values of the variables are unspecified.
+      */
+    static mpfr_t* acquire(const unsigned int n) {
+        const mpfr_prec_t precision = get_mpfr_precision();
+        if (!destroyed()) {
+            std::vector<mpfr_t*> &blocks = free_list(n, precision);
+            if (!blocks.empty()) {
+                mpfr_t* block = blocks.back();
+                blocks.pop_back();
+                return block;
+            }
+        }
+        mpfr_t* block = new mpfr_t[n];
+        for (unsigned int i=0; i < n; i++) mpfr_init2(block[i], precision);
+        return block;
+    }
+
+    /** \brief Give an array of MPFR variables back to the pool
+      * \param [in] block array obtained from acquire()
+      * \param [in] n number of variables
+      */
+    static void release(mpfr_t* block, const unsigned int n) {
+        const mpfr_prec_t precision = mpfr_get_prec(block[0]);
+        bool uniform = true;
+        for (unsigned int i=1; i < n; i++)
+            uniform = uniform && mpfr_get_prec(block[i]) == precision;
+        if (uniform && !destroyed()) {
+            std::vector<mpfr_t*> &blocks = free_list(n, precision);
+            if (blocks.size() < capacity) {
+                blocks.push_back(block);
+                return;
+            }
+        }
+        destroy(block, n);
+    }
+
+    /** \brief Free all arrays in the pool of the calling thread
+      */
+    static void clear() {
+        if (destroyed()) return;
+        storage().clear();
+    }
+
+ private:
+    struct FreeList {
+        unsigned int n;
+        mpfr_prec_t precision;
+        std::vector<mpfr_t*> blocks;
+    };
+
+    struct Storage {
+        std::vector<FreeList> lists;
+        void clear() {
+            for (FreeList &list : lists) {
+                for (mpfr_t* block : list.blocks) destroy(block, list.n);
+            }
+            lists.clear();
+        }
+        ~Storage() {
+            clear();
+            destroyed() = true;
+        }
+    };
+
+    // set once the pool of the calling thread is gone (thread exit),
+    // later releases of static objects then free their arrays directly
+    static bool& destroyed() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    static Storage& storage() {
+        static thread_local Storage pool;
+        return pool;
+    }
+
+    static std::vector<mpfr_t*>& free_list(
+        const unsigned int n,
+        const mpfr_prec_t precision
+    ) {
+        std::vector<FreeList> &lists = storage().lists;
+        for (FreeList &list : lists) {
+            if (list.n == n && list.precision == precision)
+                return list.blocks;
+        }
+        lists.push_back(FreeList{n, precision, std::vector<mpfr_t*>()});
+        return lists.back().blocks;
+    }
+
+    static void destroy(mpfr_t* block, const unsigned int n) {
+        for (unsigned int i=0; i < n; i++) mpfr_clear(block[i]);
+        delete[] block;
+    }
+};
+
+/** \brief Check if MPFR may be used from several threads at once
+  * \return true if MPFR was built with thread-local storage
+  *
+  * Without it the caches of MPFR are shared between threads
+  * and the batch operations on MPFR numbers run on a single thread.
+  */
+inline bool is_mpfr_thread_safe() {
+    return mpfr_buildopt_tls_p();
+}
+
+/** \brief MPFR memory cleanup of the calling thread
+  *
+  * Empties the pool of MPFR variables and the MPFR caches
+  * (e.g. of constants) of the calling thread only,
+  * so it may be called at any time from any thread,
+  * typically before a thread that used MPFR numbers ends.
+  */
+inline void clear_mpfr_thread_memory() {
+    MPFRPool::clear();
+    mpfr_free_cache2(MPFR_FREE_LOCAL_CACHE);
+}
+
+/** \brief Wrapper for MPFR memory cleanup
+  *
+  * Also empties the pool of MPFR variables of the calling thread.
+  * This releases memory shared by all threads: call it only when
+  * no other thread is using MPFR, otherwise use
+  * clear_mpfr_thread_memory() instead.
+  */
+inline void clear_mpfr_memory() {
+    MPFRPool::clear();
+    mpfr_free_cache();
+    assert(!mpfr_mp_memory_cleanup());
+}
+
+/** \brief Multiply two arrays of MPFR variables
+  * \param [in] H1 LHS operand, dim variables
+  * \param [in] H2 RHS operand, dim variables
+  * \param [out] out dim initialised variables for the product
+  * \param [in,out] workspace dim initialised variables for leaves
+  *
+  * Table-driven counterpart of the recursive definition: nothing
+  * is allocated, every leaf product and partial sum is rounded
+  * to the precision of the workspace, the components of the
+  * product to the precision of out.
+  * The output must not alias the operands nor the workspace.
+  */
+template <const unsigned int dim>
+void cayley_dickson_multiply(
+    const mpfr_t *H1,
+    const mpfr_t *H2,
+    mpfr_t *out,
+    mpfr_t *workspace
+) {
+    static constexpr CayleyDicksonTable<dim> table =
+        cayley_dickson_table<dim>();
+    if constexpr (dim == 1) {
+        mpfr_mul(out[0], H1[0], H2[0], MPFR_RNDN);
+    } else {
+        mpfr_t *leaves = workspace;
+        for (unsigned int k=0; k < dim; k++) {
+            for (unsigned int p=0; p < dim; p++) {
+                mpfr_mul(leaves[p], H1[table.lhs[k][p]],
+                         H2[table.rhs[k][p]], MPFR_RNDN);
+                if (table.neg[k][p]) mpfr_neg(leaves[p], leaves[p], MPFR_RNDN);
+            }
+            // same pairwise reduction as in the scalar kernel,
+            // the last level is written straight into the output
+            for (unsigned int m=2; m <= dim; m *= 2) {
+                mpfr_t *sums = m == dim ? out + k : leaves;
+                for (unsigned int q=0; q < dim / m; q++) {
+                    if (k & (m / 2)) {
+                        mpfr_add(sums[q], leaves[2*q], leaves[2*q+1],
+                                 MPFR_RNDN);
+                    } else {
+                        mpfr_sub(sums[q], leaves[2*q], leaves[2*q+1],
+                                 MPFR_RNDN);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** \brief Multiply two arrays of MPFR variables, correctly rounded
+  * \param [in] H1 LHS operand, dim variables
+  * \param [in] H2 RHS operand, dim variables
+  * \param [out] out dim initialised variables for the product
+  * \param [in,out] leaves dim initialised variables, precision
+  * at least the sum of the precisions of the operands
+  *
+  * Every component of the product is a signed sum of dim leaf
+  * products, the signs combining the table with the subtractions
+  * of cayley_dickson_multiply(). With wide enough leaves these
+  * are exact and mpfr_sum rounds the whole sum once, to the
+  * precision of out: the result is the exact product rounded to
+  * nearest, independently of the order of the terms.
+  * The output must not alias the operands nor the leaves.
+  */
+template <const unsigned int dim>
+void cayley_dickson_rounded_multiply(
+    const mpfr_t *H1,
+    const mpfr_t *H2,
+    mpfr_t *out,
+    mpfr_t *leaves
+) {
+    static constexpr CayleyDicksonTable<dim> table =
+        cayley_dickson_table<dim>();
+    mpfr_ptr terms[dim];  // NOLINT
+    for (unsigned int k=0; k < dim; k++) {
+        for (unsigned int p=0; p < dim; p++) {
+            mpfr_mul(leaves[p], H1[table.lhs[k][p]],
+                     H2[table.rhs[k][p]], MPFR_RNDN);
+            // the pairwise reduction subtracts the right half at every
+            // level where k has a zero bit: one sign flip per such
+            // bit set in p
+            bool negative = table.neg[k][p];
+            for (unsigned int bits = p & ~k; bits; bits &= bits - 1)
+                negative = !negative;
+            if (negative) mpfr_neg(leaves[p], leaves[p], MPFR_RNDN);
+            terms[p] = leaves[p];
+        }
+        mpfr_sum(out[k], terms, dim, MPFR_RNDN);
+    }
+}
+
+/** \brief Multiply two arrays of MPFR variables with fewer multiplications
+  * \param [in] H1 LHS operand, dim variables
+  * \param [in] H2 RHS operand, dim variables
+  * \param [out] out dim initialised variables for the product
+  *
+  * Same algorithms as the generic cayley_dickson_reduced_multiply():
+  * dim^2 / 2 multiplications from dimension 4 on, 3 for complex
+  * numbers. Temporaries are taken from the pool at the current
+  * precision. The output must not alias the operands.
+  */
+template <const unsigned int dim>
+void cayley_dickson_reduced_multiply(
+    const mpfr_t *H1,
+    const mpfr_t *H2,
+    mpfr_t *out
+) {
+    if constexpr (dim == 1) {
+        mpfr_mul(out[0], H1[0], H2[0], MPFR_RNDN);
+    } else if constexpr (dim == 2) {
+        mpfr_t* t = MPFRPool::acquire(3);
+        mpfr_add(t[0], H1[0], H1[1], MPFR_RNDN);
+        mpfr_mul(t[0], t[0], H2[0], MPFR_RNDN);  // k1
+        mpfr_sub(t[1], H2[1], H2[0], MPFR_RNDN);
+        mpfr_mul(t[1], t[1], H1[0], MPFR_RNDN);  // k2
+        mpfr_add(t[2], H2[0], H2[1], MPFR_RNDN);
+        mpfr_mul(t[2], t[2], H1[1], MPFR_RNDN);  // k3
+        mpfr_sub(out[0], t[0], t[2], MPFR_RNDN);
+        mpfr_add(out[1], t[0], t[1], MPFR_RNDN);
+        MPFRPool::release(t, 3);
+    } else if constexpr (dim == 4) {
+        // t[0..7] as in the generic kernel, t[8] and t[9] for the factors
+        mpfr_t* t = MPFRPool::acquire(10);
+        static constexpr unsigned int factors[8][4] = {
+            {3, 2, 2, 3}, {0, 1, 0, 1}, {0, 1, 2, 3}, {2, 3, 0, 1},
+            {3, 1, 1, 2}, {3, 1, 1, 2}, {0, 2, 0, 3}, {0, 2, 0, 3}
+        };
+        // signs of the second term of each factor
+        static constexpr unsigned int add1[8] = {0, 1, 0, 1, 0, 1, 1, 0};
+        static constexpr unsigned int add2[8] = {0, 1, 1, 0, 0, 1, 0, 1};
+        for (unsigned int i=0; i < 8; i++) {
+            const unsigned int *f = factors[i];
+            if (add1[i]) mpfr_add(t[8], H1[f[0]], H1[f[1]], MPFR_RNDN);
+            else
+                mpfr_sub(t[8], H1[f[0]], H1[f[1]], MPFR_RNDN);
+            if (add2[i]) mpfr_add(t[9], H2[f[2]], H2[f[3]], MPFR_RNDN);
+            else
+                mpfr_sub(t[9], H2[f[2]], H2[f[3]], MPFR_RNDN);
+            mpfr_mul(t[i], t[8], t[9], MPFR_RNDN);
+        }
+        mpfr_add(t[8], t[5], t[6], MPFR_RNDN);
+        mpfr_add(t[8], t[8], t[7], MPFR_RNDN);
+        mpfr_add(t[9], t[4], t[8], MPFR_RNDN);
+        mpfr_div_2ui(t[9], t[9], 1, MPFR_RNDN);
+        mpfr_add(out[0], t[0], t[9], MPFR_RNDN);
+        mpfr_sub(out[0], out[0], t[5], MPFR_RNDN);
+        mpfr_add(out[1], t[1], t[9], MPFR_RNDN);
+        mpfr_sub(out[1], out[1], t[8], MPFR_RNDN);
+        mpfr_add(out[2], t[2], t[9], MPFR_RNDN);
+        mpfr_sub(out[2], out[2], t[7], MPFR_RNDN);
+        mpfr_add(out[3], t[3], t[9], MPFR_RNDN);
+        mpfr_sub(out[3], out[3], t[6], MPFR_RNDN);
+        MPFRPool::release(t, 10);
+    } else {
+        constexpr unsigned int h = dim / 2;
+        const mpfr_t *a = H1, *b = H1 + h, *c = H2, *d = H2 + h;
+        // conj(c), conj(d) and the four products of the halves
+        mpfr_t* t = MPFRPool::acquire(6 * h);
+        mpfr_t *conj_c = t, *conj_d = t + h;
+        mpfr_t *p1 = t + 2 * h, *p2 = t + 3 * h, *p3 = t + 4 * h;
+        mpfr_t *p4 = t + 5 * h;
+        mpfr_set(conj_c[0], c[0], MPFR_RNDN);
+        mpfr_set(conj_d[0], d[0], MPFR_RNDN);
+        for (unsigned int i=1; i < h; i++) {
+            mpfr_neg(conj_c[i], c[i], MPFR_RNDN);
+            mpfr_neg(conj_d[i], d[i], MPFR_RNDN);
+        }
+        cayley_dickson_reduced_multiply<h>(a, c, p1);
+        cayley_dickson_reduced_multiply<h>(conj_d, b, p2);
+        cayley_dickson_reduced_multiply<h>(d, a, p3);
+        cayley_dickson_reduced_multiply<h>(b, conj_c, p4);
+        for (unsigned int i=0; i < h; i++) {
+            mpfr_sub(out[i], p1[i], p2[i], MPFR_RNDN);
+            mpfr_add(out[h + i], p3[i], p4[i], MPFR_RNDN);
+        }
+        MPFRPool::release(t, 6 * h);
+    }
+}
+
+/** \brief Multiply two arrays of MPFR variables in the current mode
+  * \param [in] H1 LHS operand, dim variables
+  * \param [in] H2 RHS operand, dim variables
+  * \param [out] out dim initialised variables for the product
+  *
+  * Takes the workspace of the chosen kernel from the pool,
+  * see set_mpfr_rounded_multiplication() and ReducedMultiplication.
+  * The output must not alias the operands.
+  */
+template <const unsigned int dim>
+void mpfr_multiply(const mpfr_t *H1, const mpfr_t *H2, mpfr_t *out) {
+    if (dim > 1 && is_mpfr_multiplication_reduced(get_mpfr_precision())) {
+        cayley_dickson_reduced_multiply<dim>(H1, H2, out);
+        return;
+    }
+    if (!get_mpfr_rounded_multiplication()) {
+        mpfr_t* workspace = MPFRPool::acquire(dim);
+        cayley_dickson_multiply<dim>(H1, H2, out, workspace);
+        MPFRPool::release(workspace, dim);
+        return;
+    }
+    // leaves wide enough for exact products of any two components
+    mpfr_prec_t p1 = MPFR_PREC_MIN, p2 = MPFR_PREC_MIN;
+    for (unsigned int i=0; i < dim; i++) {
+        p1 = std::max(p1, mpfr_get_prec(H1[i]));
+        p2 = std::max(p2, mpfr_get_prec(H2[i]));
+    }
+    mpfr_t* leaves;
+    {
+        MPFRPrecisionScope exact(static_cast<unsigned int>(p1 + p2));
+        leaves = MPFRPool::acquire(dim);
+    }
+    cayley_dickson_rounded_multiply<dim>(H1, H2, out, leaves);
+    MPFRPool::release(leaves, dim);
+}
+
+/** \brief Divide two arrays of MPFR variables in the current mode
+  * \param [in] H1 dividend, dim variables
+  * \param [in] H2 divisor, dim variables
+  * \param [out] out dim initialised variables for the quotient
+  *
+  * H1 / H2 = (H1 ~H2) / |H2|^2: the squared norm takes no square root
+  * and every component of the product mpfr_multiply() is divided once.
+  * The output must not alias the operands.
   */
-void clear_mpfr_memory() {
-    mpfr_free_cache();
-    assert(!mpfr_mp_memory_cleanup());
+template <const unsigned int dim>
+void mpfr_divide(const mpfr_t *H1, const mpfr_t *H2, mpfr_t *out) {
+    mpfr_t* scratch = MPFRPool::acquire(dim + 2);
+    mpfr_t *conj = scratch;
+    mpfr_t &norm2 = scratch[dim], &temp = scratch[dim + 1];
+    mpfr_set_zero(norm2, 0);
+    for (unsigned int i=0; i < dim; i++) {
+        mpfr_mul(temp, H2[i], H2[i], MPFR_RNDN);
+        mpfr_add(norm2, norm2, temp, MPFR_RNDN);
+    }
+    if (mpfr_zero_p(norm2)) {
+        MPFRPool::release(scratch, dim + 2);
+        throw std::invalid_argument("division by zero");
+    }
+    mpfr_set(conj[0], H2[0], MPFR_RNDN);
+    for (unsigned int i=1; i < dim; i++) mpfr_neg(conj[i], H2[i], MPFR_RNDN);
+    mpfr_multiply<dim>(H1, conj, out);
+    for (unsigned int i=0; i < dim; i++)
+        mpfr_div(out[i], out[i], norm2, MPFR_RNDN);
+    MPFRPool::release(scratch, dim + 2);
 }
 
 /** Partial specialisation of the main class for high precision
@@ -612,6 +5059,26 @@ class Hypercomplex<mpfr_t, dim> {
  private:
     mpfr_t* arr;
 
+    // take over the variables of a result, or round it into the ones of
+    // the caller if they differ in precision (e.g. inside a precision
+    // scope), so that assignments never change the caller's precision;
+    // the result is left with the variables to release
+    void take(mpfr_t* &result) noexcept {
+        bool same = true;
+        if (arr != nullptr && result != nullptr) {  // else moved-from
+            for (unsigned int i=0; i < dim; i++) {
+                same = same &&
+                    mpfr_get_prec(arr[i]) == mpfr_get_prec(result[i]);
+            }
+        }
+        if (same) {
+            std::swap(arr, result);
+        } else {
+            for (unsigned int i=0; i < dim; i++)
+                mpfr_set(arr[i], result[i], MPFR_RNDN);
+        }
+    }
+
  public:
     /** \brief This is the main constructor
       * \param [in] ARR array of MPFR numbers
@@ -625,9 +5092,7 @@ class Hypercomplex<mpfr_t, dim> {
         if ((dim & (dim - 1)) != 0) {
             throw std::invalid_argument("invalid dimension");
         }
-        arr = new mpfr_t[dim];
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_init2(arr[i], MPFR_global_precision);
+        arr = MPFRPool::acquire(dim);
         for (unsigned int i=0; i < dim; i++)
             mpfr_set(arr[i], ARR[i], MPFR_RNDN);
     }
@@ -640,18 +5105,28 @@ class Hypercomplex<mpfr_t, dim> {
       * * dimensionality of the algebra
       */
     Hypercomplex(const Hypercomplex &H) {
-        arr = new mpfr_t[dim];
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_init2(arr[i], MPFR_global_precision);
+        arr = MPFRPool::acquire(dim);
         for (unsigned int i=0; i < dim; i++)
             mpfr_set(arr[i], H[i], MPFR_RNDN);
     }
 
+    /** \brief This is the move constructor
+      * \param [in] H existing class instance
+      * \return new class instance
+      * 
+      * The MPFR variables of the argument are taken over
+      * without any allocation. The moved-from object may only
+      * be destroyed or assigned to.
+      */
+    Hypercomplex(Hypercomplex &&H) noexcept : arr(H.arr) {
+        H.arr = nullptr;
+    }
+
     Hypercomplex() = delete;
 
     ~Hypercomplex() {
-        for (unsigned int i=0; i < dim; i++) mpfr_clear(arr[i]);
-        delete[] arr;
+        if (arr == nullptr) return;  // moved-from object
+        MPFRPool::release(arr, dim);
     }
 
     /** \brief Dimensionality getter
@@ -669,15 +5144,15 @@ class Hypercomplex<mpfr_t, dim> {
       * argument a variable to store the output in.
       */
     int norm(mpfr_t norm) const {
-        mpfr_t temp;
-        mpfr_init2(temp, MPFR_global_precision);
+        mpfr_t* scratch = MPFRPool::acquire(1);
+        mpfr_t &temp = scratch[0];
         mpfr_set_zero(norm, 0);
         for (unsigned int i=0; i < dim; i++) {
             mpfr_mul(temp, arr[i], arr[i], MPFR_RNDN);
             mpfr_add(norm, norm, temp, MPFR_RNDN);
         }
         mpfr_sqrt(norm, norm, MPFR_RNDN);
-        mpfr_clear(temp);
+        MPFRPool::release(scratch, 1);
         return 0;
     }
 
@@ -685,30 +5160,26 @@ class Hypercomplex<mpfr_t, dim> {
       * \return new class instance
       */
     Hypercomplex inv() const {
-        mpfr_t zero, norm;
-        mpfr_init2(zero, MPFR_global_precision);
-        mpfr_init2(norm, MPFR_global_precision);
+        mpfr_t* scratch = MPFRPool::acquire(3);
+        mpfr_t &zero = scratch[0], &norm2 = scratch[1], &temp = scratch[2];
         mpfr_set_zero(zero, 0);
-        (*this).norm(norm);
-        if (mpfr_equal_p(norm, zero)) {
-            mpfr_clear(zero);
-            mpfr_clear(norm);
+        // squared norm without a square root
+        mpfr_set_zero(norm2, 0);
+        for (unsigned int i=0; i < dim; i++) {
+            mpfr_mul(temp, arr[i], arr[i], MPFR_RNDN);
+            mpfr_add(norm2, norm2, temp, MPFR_RNDN);
+        }
+        if (mpfr_equal_p(norm2, zero)) {
+            MPFRPool::release(scratch, 3);
             throw std::invalid_argument("division by zero");
         } else {
-            mpfr_t* temparr = new mpfr_t[dim];
-            for (unsigned int i=0; i < dim; i++)
-                mpfr_init2(temparr[i], MPFR_global_precision);
-            mpfr_mul(norm, norm, norm, MPFR_RNDN);
-            mpfr_div(temparr[0], arr[0], norm, MPFR_RNDN);
+            Hypercomplex<mpfr_t, dim> H(*this);
+            mpfr_div(H[0], arr[0], norm2, MPFR_RNDN);
             for (unsigned int i=1; i < dim; i++) {
-                mpfr_div(temparr[i], arr[i], norm, MPFR_RNDN);
-                mpfr_sub(temparr[i], zero, temparr[i], MPFR_RNDN);
+                mpfr_div(H[i], arr[i], norm2, MPFR_RNDN);
+                mpfr_sub(H[i], zero, H[i], MPFR_RNDN);
             }
-            Hypercomplex<mpfr_t, dim> H(temparr);
-            mpfr_clear(zero);
-            mpfr_clear(norm);
-            for (unsigned int i=0; i < dim; i++) mpfr_clear(temparr[i]);
-            delete[] temparr;
+            MPFRPool::release(scratch, 3);
             return H;
         }
     }
@@ -722,15 +5193,12 @@ class Hypercomplex<mpfr_t, dim> {
     template <const unsigned int newdim>
     Hypercomplex<mpfr_t, newdim> expand() const {
         if (newdim <= dim) throw std::invalid_argument("invalid dimension");
-        mpfr_t* temparr = new mpfr_t[newdim];
-        for (unsigned int i=0; i < newdim; i++)
-            mpfr_init2(temparr[i], MPFR_global_precision);
+        mpfr_t* temparr = MPFRPool::acquire(newdim);
         for (unsigned int i=0; i < dim; i++)
             mpfr_set(temparr[i], arr[i], MPFR_RNDN);
         for (unsigned int i=dim; i < newdim; i++) mpfr_set_zero(temparr[i], 0);
         Hypercomplex<mpfr_t, newdim> H(temparr);
-        for (unsigned int i=0; i < newdim; i++) mpfr_clear(temparr[i]);
-        delete[] temparr;
+        MPFRPool::release(temparr, newdim);
         return H;
     }
 
@@ -738,19 +5206,13 @@ class Hypercomplex<mpfr_t, dim> {
       * \return new class instance
       */
     Hypercomplex operator~ () const {
-        mpfr_t zero;
-        mpfr_init2(zero, MPFR_global_precision);
+        mpfr_t* scratch = MPFRPool::acquire(1);
+        mpfr_t &zero = scratch[0];
         mpfr_set_zero(zero, 0);
-        mpfr_t* temparr = new mpfr_t[dim];
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_init2(temparr[i], MPFR_global_precision);
-        mpfr_set(temparr[0], arr[0], MPFR_RNDN);
+        Hypercomplex<mpfr_t, dim> H(*this);
         for (unsigned int i=1; i < dim; i++)
-            mpfr_sub(temparr[i], zero, arr[i], MPFR_RNDN);
-        Hypercomplex<mpfr_t, dim> H(temparr);
-        for (unsigned int i=0; i < dim; i++) mpfr_clear(temparr[i]);
-        delete[] temparr;
-        mpfr_clear(zero);
+            mpfr_sub(H[i], zero, arr[i], MPFR_RNDN);
+        MPFRPool::release(scratch, 1);
         return H;
     }
 
@@ -758,18 +5220,13 @@ class Hypercomplex<mpfr_t, dim> {
       * \return new class instance
       */
     Hypercomplex operator- () const {
-        mpfr_t zero;
-        mpfr_init2(zero, MPFR_global_precision);
+        mpfr_t* scratch = MPFRPool::acquire(1);
+        mpfr_t &zero = scratch[0];
         mpfr_set_zero(zero, 0);
-        mpfr_t* temparr = new mpfr_t[dim];
+        Hypercomplex<mpfr_t, dim> H(*this);
         for (unsigned int i=0; i < dim; i++)
-            mpfr_init2(temparr[i], MPFR_global_precision);
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_sub(temparr[i], zero, arr[i], MPFR_RNDN);
-        Hypercomplex<mpfr_t, dim> H(temparr);
-        for (unsigned int i=0; i < dim; i++) mpfr_clear(temparr[i]);
-        delete[] temparr;
-        mpfr_clear(zero);
+            mpfr_sub(H[i], zero, arr[i], MPFR_RNDN);
+        MPFRPool::release(scratch, 1);
         return H;
     }
 
@@ -779,11 +5236,26 @@ class Hypercomplex<mpfr_t, dim> {
       */
     Hypercomplex& operator= (const Hypercomplex &H) {
         if (this == &H) return *this;
+        if (arr == nullptr) arr = MPFRPool::acquire(dim);  // moved-from
         for (unsigned int i=0; i < dim; i++)
             mpfr_set(arr[i], H[i], MPFR_RNDN);
         return *this;
     }
 
+    /** \brief Move-Assignment operator
+      * \param [in] H existing class instance
+      * \return Reference to the caller (for chained assignments)
+      * 
+      * Swaps the MPFR variables of both objects if their precisions
+      * agree, the argument is left to release the old ones. Otherwise
+      * the components are rounded to the precision of the caller,
+      * as by the copy assignment.
+      */
+    Hypercomplex& operator= (Hypercomplex &&H) noexcept {
+        take(H.arr);
+        return *this;
+    }
+
     /** \brief Access operator
       * \param [in] i index for the element to access
       * \return i-th element of the number
@@ -798,9 +5270,8 @@ class Hypercomplex<mpfr_t, dim> {
       * \return Reference to the caller
       */
     Hypercomplex& operator+= (const Hypercomplex &H) {
-        Hypercomplex<mpfr_t, dim> result = (*this) + H;
         for (unsigned int i=0; i < dim; i++)
-            mpfr_set((*this)[i], result[i], MPFR_RNDN);
+            mpfr_add(arr[i], arr[i], H[i], MPFR_RNDN);
         return *this;
     }
 
@@ -809,9 +5280,8 @@ class Hypercomplex<mpfr_t, dim> {
       * \return Reference to the caller
       */
     Hypercomplex& operator-= (const Hypercomplex &H) {
-        Hypercomplex<mpfr_t, dim> result = (*this) - H;
         for (unsigned int i=0; i < dim; i++)
-            mpfr_set((*this)[i], result[i], MPFR_RNDN);
+            mpfr_sub(arr[i], arr[i], H[i], MPFR_RNDN);
         return *this;
     }
 
@@ -820,20 +5290,21 @@ class Hypercomplex<mpfr_t, dim> {
       * \return Reference to the caller
       */
     Hypercomplex& operator*= (const Hypercomplex &H) {
-        Hypercomplex<mpfr_t, dim> result = (*this) * H;
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_set((*this)[i], result[i], MPFR_RNDN);
+        // the product replaces the MPFR variables of the caller
+        mpfr_t* product = MPFRPool::acquire(dim);
+        mpfr_multiply<dim>(arr, H.arr, product);
+        take(product);
+        MPFRPool::release(product, dim);
         return *this;
     }
 
     /** \brief Power-Assignment operator
-      * \param [in] x power
+      * \param [in] x integer power, negative powers raise the inverse
       * \return Reference to the caller
       */
-    Hypercomplex& operator^= (const unsigned int x) {
-        Hypercomplex<mpfr_t, dim> result = (*this) ^ x;
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_set((*this)[i], result[i], MPFR_RNDN);
+    template <typename I>
+    Hypercomplex& operator^= (const I x) {
+        *this = (*this) ^ x;
         return *this;
     }
 
@@ -842,9 +5313,11 @@ class Hypercomplex<mpfr_t, dim> {
       * \return Reference to the caller
       */
     Hypercomplex& operator/= (const Hypercomplex &H) {
-        Hypercomplex<mpfr_t, dim> result = (*this) / H;
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_set((*this)[i], result[i], MPFR_RNDN);
+        // the quotient replaces the MPFR variables of the caller
+        mpfr_t* quotient = MPFRPool::acquire(dim);
+        mpfr_divide<dim>(arr, H.arr, quotient);
+        take(quotient);
+        MPFRPool::release(quotient, dim);
         return *this;
     }
 };
@@ -888,17 +5361,30 @@ Hypercomplex<mpfr_t, dim> operator+(
     const Hypercomplex<mpfr_t, dim> &H1,
     const Hypercomplex<mpfr_t, dim> &H2
 ) {
-    mpfr_t* temparr = new mpfr_t[dim];
-    for (unsigned int i=0; i < dim; i++)
-        mpfr_init2(temparr[i], MPFR_global_precision);
+    Hypercomplex<mpfr_t, dim> H(H1);
     for (unsigned int i=0; i < dim; i++)
-        mpfr_add(temparr[i], H1[i], H2[i], MPFR_RNDN);
-    Hypercomplex<mpfr_t, dim> H(temparr);
-    for (unsigned int i=0; i < dim; i++) mpfr_clear(temparr[i]);
-    delete[] temparr;
+        mpfr_add(H[i], H1[i], H2[i], MPFR_RNDN);
     return H;
 }
 
+/** \brief Addition operator for a temporary LHS operand
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand
+  * \return new class instance
+  * 
+  * The result is accumulated in the MPFR variables of the LHS
+  * temporary, so chains such as a * b + c * d allocate nothing.
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> operator+(
+    Hypercomplex<mpfr_t, dim> &&H1,
+    const Hypercomplex<mpfr_t, dim> &H2
+) {
+    for (unsigned int i=0; i < dim; i++)
+        mpfr_add(H1[i], H1[i], H2[i], MPFR_RNDN);
+    return std::move(H1);
+}
+
 /** \brief Subtraction operator
   * \param [in] H1 LHS operand
   * \param [in] H2 RHS operand
@@ -909,17 +5395,30 @@ Hypercomplex<mpfr_t, dim> operator-(
     const Hypercomplex<mpfr_t, dim> &H1,
     const Hypercomplex<mpfr_t, dim> &H2
 ) {
-    mpfr_t* temparr = new mpfr_t[dim];
-    for (unsigned int i=0; i < dim; i++)
-        mpfr_init2(temparr[i], MPFR_global_precision);
+    Hypercomplex<mpfr_t, dim> H(H1);
     for (unsigned int i=0; i < dim; i++)
-        mpfr_sub(temparr[i], H1[i], H2[i], MPFR_RNDN);
-    Hypercomplex<mpfr_t, dim> H(temparr);
-    for (unsigned int i=0; i < dim; i++) mpfr_clear(temparr[i]);
-    delete[] temparr;
+        mpfr_sub(H[i], H1[i], H2[i], MPFR_RNDN);
     return H;
 }
 
+/** \brief Subtraction operator for a temporary LHS operand
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand
+  * \return new class instance
+  * 
+  * The result is accumulated in the MPFR variables of the LHS
+  * temporary, so chains such as a * b - c * d allocate nothing.
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> operator-(
+    Hypercomplex<mpfr_t, dim> &&H1,
+    const Hypercomplex<mpfr_t, dim> &H2
+) {
+    for (unsigned int i=0; i < dim; i++)
+        mpfr_sub(H1[i], H1[i], H2[i], MPFR_RNDN);
+    return std::move(H1);
+}
+
 /** \brief Multiplication operator
   * \param [in] H1 LHS operand
   * \param [in] H2 RHS operand
@@ -930,74 +5429,45 @@ Hypercomplex<mpfr_t, dim> operator*(
     const Hypercomplex<mpfr_t, dim> &H1,
     const Hypercomplex<mpfr_t, dim> &H2
 ) {
-    // recursion base:
-    if constexpr (dim == 1) {
-        mpfr_t result;
-        mpfr_init2(result, MPFR_global_precision);
-        mpfr_mul(result, H1[0], H2[0], MPFR_RNDN);
-        mpfr_t temparr[1];
-        mpfr_init2(temparr[0], MPFR_global_precision);
-        mpfr_set(temparr[0], result, MPFR_RNDN);
-        Hypercomplex<mpfr_t, 1> H_(temparr);
-        mpfr_clear(result);
-        mpfr_clear(temparr[0]);
-        return H_;
-    // recursion step:
-    } else {
-        // shared objects:
-        const unsigned int halfd = dim / 2;
-        mpfr_t* temparr = new mpfr_t[dim];
-        for (unsigned int i=0; i < dim; i++)
-            mpfr_init2(temparr[i], MPFR_global_precision);
-        // construct helper objects:
-        for (unsigned int i=0; i < halfd; i++)
-            mpfr_set(temparr[i], H1[i], MPFR_RNDN);
-        Hypercomplex<mpfr_t, halfd> H1a(temparr);
-        for (unsigned int i=0; i < halfd; i++)
-            mpfr_set(temparr[i], H1[i+halfd], MPFR_RNDN);
-        Hypercomplex<mpfr_t, halfd> H1b(temparr);
-        for (unsigned int i=0; i < halfd; i++)
-            mpfr_set(temparr[i], H2[i], MPFR_RNDN);
-        Hypercomplex<mpfr_t, halfd> H2a(temparr);
-        for (unsigned int i=0; i < halfd; i++)
-            mpfr_set(temparr[i], H2[i+halfd], MPFR_RNDN);
-        Hypercomplex<mpfr_t, halfd> H2b(temparr);
-        // multiply recursively:
-        Hypercomplex<mpfr_t, halfd> H1a2a = H1a * H2a;
-        Hypercomplex<mpfr_t, halfd> H2b_1b = ~H2b * H1b;
-        Hypercomplex<mpfr_t, halfd> H2b1a = H2b * H1a;
-        Hypercomplex<mpfr_t, halfd> H1b2a_ = H1b * ~H2a;
-        // construct the final object
-        Hypercomplex<mpfr_t, halfd> Ha = H1a2a - H2b_1b;
-        Hypercomplex<mpfr_t, halfd> Hb = H2b1a + H1b2a_;
-        for (unsigned int i=0; i < halfd; i++)
-            mpfr_set(temparr[i], Ha[i], MPFR_RNDN);
-        for (unsigned int i=0; i < halfd; i++)
-            mpfr_set(temparr[i+halfd], Hb[i], MPFR_RNDN);
-        Hypercomplex<mpfr_t, dim> H(temparr);
-        for (unsigned int i=0; i < dim; i++) mpfr_clear(temparr[i]);
-        delete[] temparr;
-        return H;
-    }
+    Hypercomplex<mpfr_t, dim> H(H1);
+    mpfr_multiply<dim>(&H1[0], &H2[0], &H[0]);
+    return H;
 }
 
 /** \brief Power operator
   * \param [in] H LHS operand
-  * \param [in] x RHS operand
+  * \param [in] x RHS operand: integer power
   * \return new class instance
+  * 
+  * Computed by repeated squaring in O(log|x|) multiplications.
+  * Zero power yields the identity, negative powers raise the inverse.
   */
-template <const unsigned int dim>
+template <const unsigned int dim, typename I>
 Hypercomplex<mpfr_t, dim> operator^(
     const Hypercomplex<mpfr_t, dim> &H,
-    const unsigned int x
+    const I x
 ) {
-    if (!(x)) {
-        throw std::invalid_argument("zero is not a valid argument");
-    } else {
-        Hypercomplex<mpfr_t, dim> Hx(H);
-        for (unsigned int i=0; i < x-1; i++) Hx = Hx * H;
-        return Hx;
+    auto n = power_magnitude(x);
+    if (!n) {
+        Hypercomplex<mpfr_t, dim> H0(H);
+        for (unsigned int i=1; i < dim; i++) mpfr_set_zero(H0[i], 0);
+        mpfr_set_ui(H0[0], 1, MPFR_RNDN);
+        return H0;
+    }
+    Hypercomplex<mpfr_t, dim> base(H);
+    if constexpr (std::is_signed<I>::value) {
+        if (x < 0) base = H.inv();
+    }
+    while (!(n & 1)) {
+        base *= base;
+        n >>= 1;
+    }
+    Hypercomplex<mpfr_t, dim> Hx(base);
+    while (n >>= 1) {
+        base *= base;
+        if (n & 1) Hx *= base;
     }
+    return Hx;
 }
 
 /** \brief Division operator
@@ -1010,33 +5480,345 @@ Hypercomplex<mpfr_t, dim> operator/(
     const Hypercomplex<mpfr_t, dim> &H1,
     const Hypercomplex<mpfr_t, dim> &H2
 ) {
-    Hypercomplex<mpfr_t, dim> H = H1 * H2.inv();
-    return(H);
+    Hypercomplex<mpfr_t, dim> H(H1);
+    mpfr_divide<dim>(&H1[0], &H2[0], &H[0]);
+    return H;
 }
 
+/** Text output of MPFR numbers into a reusable buffer
+  *
+  * Digits are converted with mpfr_get_str into storage owned by the
+  * serializer, which grows to the largest number seen and is reused
+  * afterwards, so that writing many numbers does not allocate.
+  * Whole hypercomplex numbers (and arrays of them) are assembled in
+  * the buffer and passed to the stream in one call.
+  */
+class MPFRSerializer {
+ public:
+    /** Layout of a written number */
+    enum class Format {
+        /** significand digits and decimal exponent, as "31416E1";
+          * the value is 0.31416 * 10^1 (layout of operator<<)
+          */
+        mantissa_exponent,
+        /** scientific notation, as "3.1416e+00" */
+        scientific
+    };
+
+    /** \brief This is the main constructor
+      * \param [in] digits number of significant decimal digits, 0 for
+      * as many as the precision of each number requires
+      * \param [in] format layout of the written numbers
+      */
+    explicit MPFRSerializer(
+        const std::size_t digits = 0,
+        const Format format = Format::mantissa_exponent
+    ) : n_digits(digits), layout(format) {}
+
+    /** \brief Convert a single number
+      * \param [in] x number to convert
+      * \return text of the number, valid until the next call
+      */
+    std::string_view str(const mpfr_t x) {
+        text.clear();
+        append(x);
+        return text;
+    }
+
+    /** \brief Write a hypercomplex number
+      * \param [in,out] os output stream
+      * \param [in] H existing class instance
+      * \return output stream
+      *
+      * Components are separated by single spaces.
+      */
+    template <const unsigned int dim>
+    std::ostream& write(std::ostream &os, const Hypercomplex<mpfr_t, dim> &H) {
+        text.clear();
+        append(H);
+        return os.write(text.data(), text.size());
+    }
+
+    /** \brief Write an array of hypercomplex numbers
+      * \param [in,out] os output stream
+      * \param [in] H array of numbers
+      * \param [in] n number of elements
+      * \return output stream
+      *
+      * Every number is written on its own line.
+      */
+    template <const unsigned int dim>
+    std::ostream& write(
+        std::ostream &os,
+        const Hypercomplex<mpfr_t, dim> *H,
+        const std::size_t n
+    ) {
+        for (std::size_t j=0; j < n; j++) {
+            text.clear();
+            append(H[j]);
+            text += '\n';
+            if (!os.write(text.data(), text.size())) break;
+        }
+        return os;
+    }
+
+ private:
+    std::size_t n_digits;
+    Format layout;
+    std::vector<char> significand;
+    std::string text;
+
+    template <const unsigned int dim>
+    void append(const Hypercomplex<mpfr_t, dim> &H) {
+        for (unsigned int i=0; i < dim; i++) {
+            if (i) text += ' ';
+            append(H[i]);
+        }
+    }
+
+    void append(const mpfr_t x) {
+        if (mpfr_nan_p(x)) {
+            text += layout == Format::scientific ? "nan" : "@NaN@";
+            return;
+        }
+        if (mpfr_inf_p(x)) {
+            if (mpfr_signbit(x)) text += '-';
+            text += layout == Format::scientific ? "inf" : "@Inf@";
+            return;
+        }
+        // mpfr_get_str needs room for max(digits + 2, 7) characters,
+        // 0 digits stand for 1 + ceil(precision * log10(2))
+        std::size_t size = n_digits;
+        if (!size) {
+            size = 2 + static_cast<std::size_t>(mpfr_get_prec(x) * 0.30103);
+        }
+        size = std::max<std::size_t>(size + 2, 7);
+        if (significand.size() < size) significand.resize(size);
+        mpfr_exp_t exponent = 0;
+        mpfr_get_str(
+            significand.data(), &exponent, 10, n_digits, x, MPFR_RNDN);
+        const char* digits = significand.data();
+        char number[24];
+        if (layout == Format::mantissa_exponent) {
+            text += digits;
+            text += 'E';
+        } else {
+            if (*digits == '-') text += *digits++;
+            text += *digits++;
+            if (*digits) {
+                text += '.';
+                text += digits;
+            }
+            text += 'e';
+            // the value is 0.ddd * 10^exponent
+            if (!mpfr_zero_p(x)) exponent--;
+            text += exponent < 0 ? '-' : '+';
+            if (exponent < 0) exponent = -exponent;
+            if (exponent < 10) text += '0';
+        }
+        const std::to_chars_result end =
+            std::to_chars(number, number + sizeof(number), exponent);
+        text.append(number, end.ptr);
+    }
+};
+
 /** \brief Print operator
   * \param [in,out] os output stream
   * \param [in] H existing class instance
   * \return output stream
+  *
+  * Components are written with all significant digits of their
+  * precision, as by MPFRSerializer with the default settings.
   */
 template <const unsigned int dim>
 std::ostream& operator<<(
     std::ostream &os,
     const Hypercomplex<mpfr_t, dim> &H
 ) {
-    long int* exponent; // NOLINT
-    char* outstr;
-    for (unsigned int i=0; i < dim - 1; i++) {
-        outstr = mpfr_get_str(NULL, exponent, 10, 0, H[i], MPFR_RNDN);
-        os << outstr << "E" << *exponent << " ";
-        mpfr_free_str(outstr);
-    }
-    outstr = mpfr_get_str(NULL, exponent, 10, 0, H[dim - 1], MPFR_RNDN);
-    os << outstr << "E" << *exponent;
-    mpfr_free_str(outstr);
-    return os;
+    thread_local MPFRSerializer serializer;
+    return serializer.write(os, H);
 }
 
+/** Binary checkpoints of MPFR numbers
+  *
+  * Numbers are stored exactly, without decimal conversion: for every
+  * component its precision, kind and sign, exponent and the limbs of
+  * the significand as they are held in memory. A checkpoint starts
+  * with a header recording the dimension and the number of elements,
+  * together with the limb size and byte order of the machine that
+  * wrote it; it can only be read back on a machine with the same ones.
+  */
+class MPFRCheckpoint {
+ public:
+    /** \brief Write an array of hypercomplex numbers
+      * \param [in,out] os binary output stream
+      * \param [in] H array of numbers
+      * \param [in] n number of elements
+      * \return output stream
+      */
+    template <const unsigned int dim>
+    static std::ostream& write(
+        std::ostream &os,
+        const Hypercomplex<mpfr_t, dim> *H,
+        const std::size_t n
+    ) {
+        std::string buffer(magic, sizeof(magic));
+        put<std::uint8_t>(buffer, version);
+        put<std::uint8_t>(buffer, GMP_NUMB_BITS);
+        put<std::uint32_t>(buffer, byte_order);
+        put<std::uint32_t>(buffer, dim);
+        put<std::uint64_t>(buffer, n);
+        os.write(buffer.data(), buffer.size());
+        for (std::size_t j=0; j < n && os; j++) {
+            buffer.clear();
+            for (unsigned int i=0; i < dim; i++) {
+                const mpfr_prec_t precision = mpfr_get_prec(H[j][i]);
+                const int kind = mpfr_custom_get_kind(H[j][i]);
+                put<std::int64_t>(buffer, precision);
+                put<std::int8_t>(buffer, kind);
+                if (kind != MPFR_REGULAR_KIND && kind != -MPFR_REGULAR_KIND)
+                    continue;
+                put<std::int64_t>(buffer, mpfr_custom_get_exp(H[j][i]));
+                buffer.append(
+                    static_cast<const char*>(
+                        mpfr_custom_get_significand(H[j][i])),
+                    mpfr_custom_get_size(precision));
+            }
+            os.write(buffer.data(), buffer.size());
+        }
+        return os;
+    }
+
+    /** \brief Write a hypercomplex number
+      * \param [in,out] os binary output stream
+      * \param [in] H existing class instance
+      * \return output stream
+      */
+    template <const unsigned int dim>
+    static std::ostream& write(
+        std::ostream &os,
+        const Hypercomplex<mpfr_t, dim> &H
+    ) {
+        return write(os, &H, 1);
+    }
+
+    /** \brief Read all numbers of a checkpoint
+      * \param [in,out] is binary input stream
+      * \return numbers in the order they were written
+      *
+      * Every number is created at the highest precision among its
+      * components, so numbers with a uniform precision (the usual
+      * case) are restored exactly, precision included.
+      * Throws std::runtime_error on a truncated or invalid checkpoint,
+      * or on one written for another dimension or machine.
+      */
+    template <const unsigned int dim>
+    static std::vector<Hypercomplex<mpfr_t, dim>> read(std::istream &is) {
+        char header[sizeof(magic)];
+        is.read(header, sizeof(magic));
+        if (!is || !std::equal(header, header + sizeof(magic), magic) ||
+            get<std::uint8_t>(is) != version ||
+            get<std::uint8_t>(is) != GMP_NUMB_BITS ||
+            get<std::uint32_t>(is) != byte_order ||
+            get<std::uint32_t>(is) != dim) {
+            throw std::runtime_error("invalid checkpoint");
+        }
+        const std::uint64_t n = get<std::uint64_t>(is);
+        std::vector<Hypercomplex<mpfr_t, dim>> result;
+        result.reserve(std::min<std::uint64_t>(n, 4096));
+        std::vector<mp_limb_t> limbs;
+        std::array<mpfr_prec_t, dim> precision;
+        std::array<int, dim> kind;
+        std::array<mpfr_exp_t, dim> exponent;
+        std::array<std::size_t, dim> offset;
+        mpfr_t view[dim];  // NOLINT
+        for (std::uint64_t j=0; j < n; j++) {
+            limbs.assign(1, 0);  // significand of singular values
+            mpfr_prec_t highest = MPFR_PREC_MIN;
+            for (unsigned int i=0; i < dim; i++) {
+                precision[i] = get<std::int64_t>(is);
+                kind[i] = get<std::int8_t>(is);
+                exponent[i] = 0;
+                offset[i] = 0;
+                if (precision[i] < MPFR_PREC_MIN ||
+                    precision[i] > MPFR_PREC_MAX ||
+                    kind[i] < -MPFR_REGULAR_KIND ||
+                    kind[i] > MPFR_REGULAR_KIND) {
+                    throw std::runtime_error("invalid checkpoint");
+                }
+                highest = std::max(highest, precision[i]);
+                if (kind[i] != MPFR_REGULAR_KIND &&
+                    kind[i] != -MPFR_REGULAR_KIND) continue;
+                exponent[i] = get<std::int64_t>(is);
+                const std::size_t size = mpfr_custom_get_size(precision[i]);
+                offset[i] = limbs.size();
+                if (!get_limbs(is, limbs, size))
+                    throw std::runtime_error("invalid checkpoint");
+                // MPFR expects the leading bit set and unused bits clear
+                mp_limb_t &low = limbs[offset[i]];
+                mp_limb_t &high = limbs.back();
+                const int unused = static_cast<int>(
+                    size * CHAR_BIT - precision[i]);
+                low &= ~static_cast<mp_limb_t>(0) << unused;
+                if (!is || exponent[i] < mpfr_get_emin() ||
+                    exponent[i] > mpfr_get_emax() ||
+                    !(high >> (GMP_NUMB_BITS - 1))) {
+                    throw std::runtime_error("invalid checkpoint");
+                }
+            }
+            if (!is) throw std::runtime_error("invalid checkpoint");
+            for (unsigned int i=0; i < dim; i++) {
+                mpfr_custom_init_set(
+                    view[i], kind[i], exponent[i], precision[i],
+                    &limbs[offset[i]]);
+            }
+            MPFRPrecisionScope scope(static_cast<unsigned int>(highest));
+            result.emplace_back(view);
+        }
+        return result;
+    }
+
+ private:
+    static constexpr char magic[6] = {'H', 'C', 'M', 'P', 'F', 'R'};
+    static constexpr std::uint8_t version = 1;
+    static constexpr std::uint32_t byte_order = 0x01020304;
+
+    template <typename I>
+    static void put(std::string &buffer, const I value) {
+        char bytes[sizeof(I)];
+        std::memcpy(bytes, &value, sizeof(I));
+        buffer.append(bytes, sizeof(I));
+    }
+
+    template <typename I>
+    static I get(std::istream &is) {
+        char bytes[sizeof(I)];
+        I value = 0;
+        if (is.read(bytes, sizeof(I))) std::memcpy(&value, bytes, sizeof(I));
+        return value;
+    }
+
+    // append size bytes of limbs; the buffer only grows by what the
+    // stream actually holds, so a corrupt precision cannot make it
+    // allocate more memory than the checkpoint takes
+    static bool get_limbs(
+        std::istream &is,
+        std::vector<mp_limb_t> &limbs,
+        std::size_t size
+    ) {
+        constexpr std::size_t chunk = std::size_t(1) << 16;
+        while (size) {
+            const std::size_t len = std::min(size, chunk);
+            const std::size_t start = limbs.size();
+            limbs.resize(start + len / sizeof(mp_limb_t));
+            if (!is.read(reinterpret_cast<char*>(&limbs[start]), len))
+                return false;
+            size -= len;
+        }
+        return true;
+    }
+};
+
 /** \brief Real part of a hypercomplex number
   * \param [in] H existing class instance
   * \return new class instance
@@ -1066,36 +5848,395 @@ Hypercomplex<mpfr_t, dim> Im(const Hypercomplex<mpfr_t, dim> &H) {
 template <const unsigned int dim>
 Hypercomplex<mpfr_t, dim> exp(const Hypercomplex<mpfr_t, dim> &H) {
     Hypercomplex<mpfr_t, dim> result = Im(H);
-    mpfr_t zero, norm, expreal;
-    mpfr_init2(zero, MPFR_global_precision);
-    mpfr_init2(norm, MPFR_global_precision);
-    mpfr_init2(expreal, MPFR_global_precision);
-    mpfr_set_zero(zero, 0);
+    mpfr_t* scratch = MPFRPool::acquire(4);
+    mpfr_t &norm = scratch[0], &expreal = scratch[1];
+    mpfr_t &sin_norm = scratch[2], &cos_norm = scratch[3];
     result.norm(norm);
     mpfr_exp(expreal, H[0], MPFR_RNDN);
 
-    if (mpfr_equal_p(norm, zero)) {
+    if (mpfr_zero_p(norm)) {
         mpfr_set(result[0], expreal, MPFR_RNDN);
         for (unsigned int i=1; i < dim; i++) mpfr_set_zero(result[i], 0);
     } else {
-        mpfr_t sinv_v;
-        mpfr_init2(sinv_v, MPFR_global_precision);
-        mpfr_sin(sinv_v, norm, MPFR_RNDN);
-        mpfr_div(sinv_v, sinv_v, norm, MPFR_RNDN);
-        for (unsigned int i=0; i < dim; i++) {
-            mpfr_mul(result[i], result[i], sinv_v, MPFR_RNDN);
+        // one joint evaluation of sine and cosine, and one scaling pass
+        mpfr_sin_cos(sin_norm, cos_norm, norm, MPFR_RNDN);
+        mpfr_mul(result[0], expreal, cos_norm, MPFR_RNDN);
+        mpfr_div(sin_norm, sin_norm, norm, MPFR_RNDN);
+        mpfr_mul(sin_norm, expreal, sin_norm, MPFR_RNDN);
+        for (unsigned int i=1; i < dim; i++) {
+            mpfr_mul(result[i], result[i], sin_norm, MPFR_RNDN);
         }
-        mpfr_cos(norm, norm, MPFR_RNDN);
-        mpfr_add(result[0], result[0], norm, MPFR_RNDN);
-        for (unsigned int i=0; i < dim; i++) {
-            mpfr_mul(result[i], result[i], expreal, MPFR_RNDN);
+    }
+    MPFRPool::release(scratch, 4);
+    return result;
+}
+
+/** \brief Natural logarithm of a hypercomplex number
+  * \param [in] H existing class instance
+  * \return new class instance
+  *
+  * log(H) = log|H| + u arg(H) as for the other base types.
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> log(const Hypercomplex<mpfr_t, dim> &H) {
+    Hypercomplex<mpfr_t, dim> result = Im(H);
+    if (dim == 1) {
+        mpfr_log(result[0], H[0], MPFR_RNDN);
+        return result;
+    }
+    mpfr_t* scratch = MPFRPool::acquire(2);
+    mpfr_t &norm = scratch[0], &arg = scratch[1];
+    result.norm(norm);
+    mpfr_atan2(arg, norm, H[0], MPFR_RNDN);
+    mpfr_hypot(result[0], H[0], norm, MPFR_RNDN);
+    mpfr_log(result[0], result[0], MPFR_RNDN);
+    if (mpfr_zero_p(norm)) {
+        for (unsigned int i=1; i < dim; i++) mpfr_set_zero(result[i], 0);
+        mpfr_set(result[1], arg, MPFR_RNDN);
+    } else {
+        mpfr_div(arg, arg, norm, MPFR_RNDN);
+        for (unsigned int i=1; i < dim; i++) {
+            mpfr_mul(result[i], result[i], arg, MPFR_RNDN);
+        }
+    }
+    MPFRPool::release(scratch, 2);
+    return result;
+}
+
+/** \brief Square root of a hypercomplex number
+  * \param [in] H existing class instance
+  * \return new class instance
+  *
+  * The root with a non-negative real part, as for the other base types.
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> sqrt(const Hypercomplex<mpfr_t, dim> &H) {
+    Hypercomplex<mpfr_t, dim> result = Im(H);
+    if (dim == 1) {
+        mpfr_sqrt(result[0], H[0], MPFR_RNDN);
+        return result;
+    }
+    mpfr_t* scratch = MPFRPool::acquire(3);
+    mpfr_t &norm = scratch[0], &w = scratch[1], &scale = scratch[2];
+    result.norm(norm);
+    // w = sqrt((|H| + |Re(H)|) / 2) does not cancel
+    mpfr_hypot(w, H[0], norm, MPFR_RNDN);
+    mpfr_abs(scale, H[0], MPFR_RNDN);
+    mpfr_add(w, w, scale, MPFR_RNDN);
+    mpfr_div_2ui(w, w, 1, MPFR_RNDN);
+    mpfr_sqrt(w, w, MPFR_RNDN);
+    const bool negative = mpfr_sgn(H[0]) < 0;
+    if (mpfr_zero_p(w)) {
+        mpfr_set(result[0], H[0], MPFR_RNDN);
+    } else if (negative) {
+        mpfr_div(result[0], norm, w, MPFR_RNDN);
+        mpfr_div_2ui(result[0], result[0], 1, MPFR_RNDN);
+        if (mpfr_zero_p(norm)) {
+            for (unsigned int i=1; i < dim; i++) mpfr_set_zero(result[i], 0);
+            mpfr_set(result[1], w, MPFR_RNDN);
+        } else {
+            mpfr_div(scale, w, norm, MPFR_RNDN);
+        }
+    } else {
+        mpfr_set(result[0], w, MPFR_RNDN);
+        mpfr_ui_div(scale, 1, w, MPFR_RNDN);
+        mpfr_div_2ui(scale, scale, 1, MPFR_RNDN);
+    }
+    if (!mpfr_zero_p(w) && !mpfr_zero_p(norm)) {
+        for (unsigned int i=1; i < dim; i++) {
+            mpfr_mul(result[i], result[i], scale, MPFR_RNDN);
+        }
+    }
+    MPFRPool::release(scratch, 3);
+    return result;
+}
+
+/** \brief Real power of a hypercomplex number
+  * \param [in] H existing class instance
+  * \param [in] p real exponent
+  * \return new class instance
+  *
+  * H^p = |H|^p (cos(p arg(H)) + u sin(p arg(H))) as for the other
+  * base types, with |H|^p from mpfr_pow. Integral exponents which fit
+  * in a long go through operator^, in dimension 1 mpfr_pow applies.
+  * Throws std::invalid_argument for a zero number and p < 0.
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> pow(
+    const Hypercomplex<mpfr_t, dim> &H,
+    const mpfr_t p
+) {
+    Hypercomplex<mpfr_t, dim> result = Im(H);
+    if (mpfr_zero_p(p)) {
+        // also for zero, infinite and NaN numbers
+        mpfr_set_ui(result[0], 1, MPFR_RNDN);
+        for (unsigned int i=1; i < dim; i++) mpfr_set_zero(result[i], 0);
+        return result;
+    }
+    if (mpfr_sgn(p) < 0) {
+        // 0^p = 1 / 0^-p, a division by zero as in inv()
+        bool is_zero = true;
+        for (unsigned int i=0; i < dim; i++)
+            is_zero = is_zero && mpfr_zero_p(H[i]);
+        if (is_zero) throw std::invalid_argument("division by zero");
+    }
+    if (mpfr_integer_p(p) && mpfr_fits_slong_p(p, MPFR_RNDN))
+        return H ^ mpfr_get_si(p, MPFR_RNDN);
+    if (dim == 1) {
+        mpfr_pow(result[0], H[0], p, MPFR_RNDN);
+        return result;
+    }
+    mpfr_t* scratch = MPFRPool::acquire(4);
+    mpfr_t &norm = scratch[0], &modulus = scratch[1];
+    mpfr_t &sin_arg = scratch[2], &cos_arg = scratch[3];
+    result.norm(norm);
+    mpfr_hypot(modulus, H[0], norm, MPFR_RNDN);
+    mpfr_pow(modulus, modulus, p, MPFR_RNDN);
+    mpfr_atan2(sin_arg, norm, H[0], MPFR_RNDN);
+    mpfr_mul(sin_arg, sin_arg, p, MPFR_RNDN);
+    mpfr_sin_cos(sin_arg, cos_arg, sin_arg, MPFR_RNDN);
+    mpfr_mul(result[0], modulus, cos_arg, MPFR_RNDN);
+    mpfr_mul(sin_arg, modulus, sin_arg, MPFR_RNDN);
+    if (mpfr_zero_p(norm)) {
+        for (unsigned int i=1; i < dim; i++) mpfr_set_zero(result[i], 0);
+        mpfr_set(result[1], sin_arg, MPFR_RNDN);
+    } else {
+        mpfr_div(sin_arg, sin_arg, norm, MPFR_RNDN);
+        for (unsigned int i=1; i < dim; i++) {
+            mpfr_mul(result[i], result[i], sin_arg, MPFR_RNDN);
         }
-        mpfr_clear(sinv_v);
     }
-    mpfr_clear(zero);
-    mpfr_clear(norm);
-    mpfr_clear(expreal);
+    MPFRPool::release(scratch, 4);
     return result;
 }
 
+/** \brief Hypercomplex power of a hypercomplex number
+  * \param [in] H1 base
+  * \param [in] H2 exponent
+  * \return new class instance
+  *
+  * H1^H2 = exp(log(H1) H2) as for the other base types.
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> pow(
+    const Hypercomplex<mpfr_t, dim> &H1,
+    const Hypercomplex<mpfr_t, dim> &H2
+) {
+    return exp(log(H1) * H2);
+}
+
+// largest exponent of the components H[first], ..., H[dim-1],
+// every such component is below 2^e in magnitude; 0 if all are zero
+template <const unsigned int dim>
+mpfr_exp_t max_component_exponent(
+    const Hypercomplex<mpfr_t, dim> &H,
+    const unsigned int first = 0
+) {
+    bool found = false;
+    mpfr_exp_t e = 0;
+    for (unsigned int i=first; i < dim; i++) {
+        if (!mpfr_regular_p(H[i])) continue;
+        if (!found || mpfr_get_exp(H[i]) > e) e = mpfr_get_exp(H[i]);
+        found = true;
+    }
+    return e;
+}
+
+/** \brief Adaptive-precision evaluation (Ziv's strategy)
+  * \param [in] precision target precision in bits
+  * \param [in] evaluate function computing the result at the precision
+  * of the calling thread
+  * \param [in] scale function of that result returning an exponent E,
+  * such that the absolute error of every component is below 2^(E - w)
+  * at working precision w
+  * \return result rounded to the target precision
+  *
+  * The result is first computed with 32 guard bits. A component is
+  * accepted if it rounds to the same number at the target precision
+  * for all values within the error bound, or if it is negligible
+  * (below 2^(E - precision)) compared to the number. Otherwise the
+  * working precision is raised by half and the evaluation repeated,
+  * up to 64 times the target precision, beyond which the last result
+  * is rounded anyway (exact midpoints between two numbers can never
+  * be decided).
+  */
+template <const unsigned int dim, typename F, typename S>
+Hypercomplex<mpfr_t, dim> ziv_evaluate(
+    const unsigned int precision,
+    const F &evaluate,
+    const S &scale
+) {
+    const unsigned int limit = 64 * precision;
+    unsigned int working = precision + 32;
+    for (;;) {
+        MPFRPrecisionScope scope(working);
+        Hypercomplex<mpfr_t, dim> H = evaluate();
+        const mpfr_exp_t E = scale(H);
+        bool rounded = true;
+        for (unsigned int i=0; i < dim && rounded; i++) {
+            if (!mpfr_regular_p(H[i])) continue;  // zero, inf or NaN
+            const mpfr_exp_t e = mpfr_get_exp(H[i]);
+            if (e <= E - static_cast<mpfr_exp_t>(precision)) continue;
+            rounded = mpfr_can_round(H[i], e - (E - working),
+                                     MPFR_RNDN, MPFR_RNDN, precision);
+        }
+        if (rounded || working >= limit) {
+            MPFRPrecisionScope target(precision);
+            return Hypercomplex<mpfr_t, dim>(H);
+        }
+        working += std::max(32u, working / 2);
+    }
+}
+
+/** \brief Additional error of a product computed by the reduced kernel
+  * \param [in] R product at the working precision
+  * \return binary logarithm of the factor to apply to the error bound
+  *
+  * The errors of cayley_dickson_reduced_multiply() stay below
+  * 2^(levels + 8) ulps of 2^(e1+e2), against 2^(2 levels + 2)
+  * for the default kernel.
+  */
+template <const unsigned int dim>
+mpfr_exp_t reduced_multiplication_error(const Hypercomplex<mpfr_t, dim> &R) {
+    const int levels = static_cast<int>(cayley_dickson_levels(dim));
+    if (dim == 1 || !is_mpfr_multiplication_reduced(mpfr_get_prec(R[0])))
+        return 0;
+    return std::max(0, 6 - levels);
+}
+
+/** \brief Multiplication with results correct to a given precision
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand
+  * \param [in] precision target precision in bits
+  * \return new class instance at the target precision
+  *
+  * See ziv_evaluate(): the working precision grows only
+  * if the product cannot be rounded correctly.
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> adaptive_multiply(
+    const Hypercomplex<mpfr_t, dim> &H1,
+    const Hypercomplex<mpfr_t, dim> &H2,
+    const unsigned int precision = get_mpfr_precision()
+) {
+    // every component is a sum of dim leaves below 2^(e1+e2),
+    // each rounded once and summed in log2(dim) rounded levels
+    const unsigned int levels = cayley_dickson_levels(dim);
+    const mpfr_exp_t E = max_component_exponent(H1) +
+        max_component_exponent(H2) + 2 * levels + 2;
+    return ziv_evaluate<dim>(precision,
+        [&]() { return H1 * H2; },
+        [=](const Hypercomplex<mpfr_t, dim> &R) {
+            return E + reduced_multiplication_error<dim>(R);
+        });
+}
+
+/** \brief Inverse with results correct to a given precision
+  * \param [in] H operand
+  * \param [in] precision target precision in bits
+  * \return new class instance at the target precision
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> adaptive_inv(
+    const Hypercomplex<mpfr_t, dim> &H,
+    const unsigned int precision = get_mpfr_precision()
+) {
+    // components are below 1/|H| with (dim + 4) roundings on the way
+    const unsigned int levels = cayley_dickson_levels(dim);
+    const mpfr_exp_t E = 1 - max_component_exponent(H) + levels + 3;
+    return ziv_evaluate<dim>(precision,
+        [&]() { return H.inv(); },
+        [=](const Hypercomplex<mpfr_t, dim> &) { return E; });
+}
+
+/** \brief Division with results correct to a given precision
+  * \param [in] H1 LHS operand
+  * \param [in] H2 RHS operand
+  * \param [in] precision target precision in bits
+  * \return new class instance at the target precision
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> adaptive_divide(
+    const Hypercomplex<mpfr_t, dim> &H1,
+    const Hypercomplex<mpfr_t, dim> &H2,
+    const unsigned int precision = get_mpfr_precision()
+) {
+    // bound of the inverse, propagated through the product
+    const unsigned int levels = cayley_dickson_levels(dim);
+    const mpfr_exp_t E = max_component_exponent(H1) + 1 -
+        max_component_exponent(H2) + 3 * levels + 6;
+    return ziv_evaluate<dim>(precision,
+        [&]() { return H1 / H2; },
+        [=](const Hypercomplex<mpfr_t, dim> &R) {
+            return E + reduced_multiplication_error<dim>(R);
+        });
+}
+
+/** \brief Exponentiation with results correct to a given precision
+  * \param [in] H operand
+  * \param [in] precision target precision in bits
+  * \return new class instance at the target precision
+  */
+template <const unsigned int dim>
+Hypercomplex<mpfr_t, dim> adaptive_exp(
+    const Hypercomplex<mpfr_t, dim> &H,
+    const unsigned int precision = get_mpfr_precision()
+) {
+    // components are below e^Re(H); the error of |Im(H)| is
+    // amplified by sin and cos proportionally to its magnitude
+    const unsigned int levels = cayley_dickson_levels(dim);
+    const mpfr_exp_t imaginary =
+        std::max<mpfr_exp_t>(max_component_exponent(H, 1) + levels, 0);
+    return ziv_evaluate<dim>(precision,
+        [&]() { return exp(H); },
+        [=](const Hypercomplex<mpfr_t, dim> &R) {
+            return max_component_exponent(R) + imaginary + 2 * levels + 5;
+        });
+}
+
+/** Per-thread setup and cleanup of the worker threads for MPFR numbers
+  *
+  * Workers compute at the precision of the calling thread.
+  * They keep their pool of MPFR variables between batch operations
+  * and free it, with the caches (e.g. of constants) that MPFR keeps
+  * locally for every thread, when they end.
+  * MPFR builds without thread-local storage get a single thread.
+  */
+template <>
+struct ParallelContext<mpfr_t> {
+    struct State {
+        unsigned int precision;
+    };
+    static bool concurrent() {
+        return is_mpfr_thread_safe();
+    }
+    static State capture() {
+        return State{get_mpfr_precision()};
+    }
+    static void worker_enter(const State &state) {
+        MPFRPrecisionScope::thread_precision() = state.precision;
+    }
+    static void worker_exit() {
+        clear_mpfr_thread_memory();
+    }
+};
+
+/** \brief Multi-threaded element-wise Euclidean norm
+  * \param [in] H array of operands
+  * \param [out] out array of initialised MPFR variables for the norms
+  * \param [in] n number of elements
+  * \param [in] options number of threads and chunk size
+  */
+template <const unsigned int dim>
+void parallel_norm(
+    const Hypercomplex<mpfr_t, dim> *H,
+    mpfr_t *out,
+    const std::size_t n,
+    const ParallelOptions &options = ParallelOptions()
+) {
+    parallel_for<mpfr_t>(n, options, [=](std::size_t begin, std::size_t end) {
+        for (std::size_t j=begin; j < end; j++) H[j].norm(out[j]);
+    });
+}
+
 #endif  // HYPERCOMPLEX_HYPERCOMPLEX_HPP_